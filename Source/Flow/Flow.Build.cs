@@ -10,7 +10,8 @@ public class Flow : ModuleRules
 
 		PublicDependencyModuleNames.AddRange(new[]
 		{
-			"LevelSequence"
+			"LevelSequence",
+			"NetCore"
 		});
 
 		PrivateDependencyModuleNames.AddRange(new[]
@@ -11,13 +11,17 @@
 #include "Nodes/Route/FlowNode_Start.h"
 #include "Nodes/Route/FlowNode_SubGraph.h"
 
+#include "Algo/BinarySearch.h"
 #include "Engine/World.h"
+#include "Misc/App.h"
 #include "Serialization/MemoryReader.h"
 #include "Serialization/MemoryWriter.h"
 
 #if WITH_EDITOR
 #include "FlowMessageLog.h"
 #include "FlowLogChannels.h"
+#include "Nodes/FlowNodeBlueprint.h"
+#include "UObject/ObjectSaveContext.h"
 
 #include "Editor.h"
 #include "Editor/EditorEngine.h"
@@ -30,17 +34,193 @@ FString UFlowAsset::ValidationError_NodeClassNotAllowed = TEXT("Node class {0} i
 FString UFlowAsset::ValidationError_NullNodeInstance = TEXT("Node with GUID {0} is NULL");
 #endif
 
+void FFlowGraphTopology::Build(const TArray<FGuid>& NodeIndexSpace, const TMap<FGuid, UFlowNode*>& Nodes, const TArray<UFlowNode*>& EntryNodes)
+{
+	Reset();
+
+	const int32 NumNodes = NodeIndexSpace.Num();
+	TArray<TArray<FName, TInlineAllocator<2>>> InputsByNode;
+	InputsByNode.SetNum(NumNodes);
+
+	ConnectedNodeOffsets.Reserve(NumNodes + 1);
+	for (int32 NodeIndex = 0; NodeIndex < NumNodes; NodeIndex++)
+	{
+		const int32 FirstConnection = ConnectedNodes.Num();
+		ConnectedNodeOffsets.Add(FirstConnection);
+
+		const UFlowNode* Node = Nodes.FindRef(NodeIndexSpace[NodeIndex]);
+		if (Node == nullptr)
+		{
+			continue;
+		}
+
+		NodesByClass.FindOrAdd(Node->GetClass()).Add(NodeIndex);
+
+		for (const TPair<FName, FConnectedPin>& Connection : Node->Connections)
+		{
+			const int32 ConnectedNodeIndex = Algo::BinarySearch(NodeIndexSpace, Connection.Value.NodeGuid);
+			if (ConnectedNodeIndex == INDEX_NONE)
+			{
+				continue;
+			}
+
+			if (!MakeArrayView(ConnectedNodes).RightChop(FirstConnection).Contains(ConnectedNodeIndex))
+			{
+				ConnectedNodes.Add(ConnectedNodeIndex);
+			}
+
+			InputsByNode[ConnectedNodeIndex].AddUnique(Connection.Value.PinName);
+		}
+	}
+	ConnectedNodeOffsets.Add(ConnectedNodes.Num());
+
+	ConnectedInputOffsets.Reserve(NumNodes + 1);
+	for (const TArray<FName, TInlineAllocator<2>>& Inputs : InputsByNode)
+	{
+		ConnectedInputOffsets.Add(ConnectedInputs.Num());
+		ConnectedInputs.Append(Inputs);
+	}
+	ConnectedInputOffsets.Add(ConnectedInputs.Num());
+
+	for (const UFlowNode* EntryNode : EntryNodes)
+	{
+		const int32 EntryNodeIndex = Algo::BinarySearch(NodeIndexSpace, EntryNode->GetGuid());
+		if (EntryNodeIndex != INDEX_NONE && !ExecutionOrders.Contains(EntryNodeIndex))
+		{
+			GatherExecutionOrder(EntryNodeIndex, ExecutionOrders.Add(EntryNodeIndex));
+		}
+	}
+
+	bBuilt = true;
+}
+
+void FFlowGraphTopology::Reset()
+{
+	ConnectedNodeOffsets.Reset();
+	ConnectedNodes.Reset();
+	ConnectedInputOffsets.Reset();
+	ConnectedInputs.Reset();
+	ExecutionOrders.Reset();
+	NodesByClass.Reset();
+	bBuilt = false;
+}
+
+TConstArrayView<int32> FFlowGraphTopology::GetConnectedNodes(const int32 NodeIndex) const
+{
+	if (IsValidNodeIndex(NodeIndex))
+	{
+		return MakeArrayView(ConnectedNodes).Slice(ConnectedNodeOffsets[NodeIndex], ConnectedNodeOffsets[NodeIndex + 1] - ConnectedNodeOffsets[NodeIndex]);
+	}
+
+	return TConstArrayView<int32>();
+}
+
+TConstArrayView<FName> FFlowGraphTopology::GetConnectedInputs(const int32 NodeIndex) const
+{
+	if (IsValidNodeIndex(NodeIndex))
+	{
+		return MakeArrayView(ConnectedInputs).Slice(ConnectedInputOffsets[NodeIndex], ConnectedInputOffsets[NodeIndex + 1] - ConnectedInputOffsets[NodeIndex]);
+	}
+
+	return TConstArrayView<FName>();
+}
+
+void FFlowGraphTopology::GatherExecutionOrder(const int32 FirstNodeIndex, TArray<int32>& OutNodeIndices) const
+{
+	FFlowGraphTraversalScratch Scratch;
+	GatherExecutionOrder(FirstNodeIndex, OutNodeIndices, Scratch);
+}
+
+void FFlowGraphTopology::GatherExecutionOrder(const int32 FirstNodeIndex, TArray<int32>& OutNodeIndices, FFlowGraphTraversalScratch& Scratch) const
+{
+	if (!IsValidNodeIndex(FirstNodeIndex))
+	{
+		return;
+	}
+
+	TBitArray<>& IteratedNodes = Scratch.IteratedNodes;
+	IteratedNodes.Reset();
+	IteratedNodes.Add(false, GetNumNodes());
+
+	TArray<TPair<int32, int32>>& NodeStack = Scratch.NodeStack;
+	NodeStack.Reset();
+
+	IteratedNodes[FirstNodeIndex] = true;
+	OutNodeIndices.Add(FirstNodeIndex);
+	NodeStack.Emplace(FirstNodeIndex, 0);
+
+	while (NodeStack.Num() > 0)
+	{
+		const TConstArrayView<int32> NodeConnections = GetConnectedNodes(NodeStack.Last().Key);
+		const int32 ConnectionIndex = NodeStack.Last().Value++;
+
+		if (ConnectionIndex < NodeConnections.Num())
+		{
+			const int32 ConnectedNodeIndex = NodeConnections[ConnectionIndex];
+			if (!IteratedNodes[ConnectedNodeIndex])
+			{
+				IteratedNodes[ConnectedNodeIndex] = true;
+				OutNodeIndices.Add(ConnectedNodeIndex);
+				NodeStack.Emplace(ConnectedNodeIndex, 0);
+			}
+		}
+		else
+		{
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION > 3
+			NodeStack.Pop(EAllowShrinking::No);
+#else
+			NodeStack.Pop(false);
+#endif
+		}
+	}
+}
+
+TConstArrayView<int32> FFlowGraphTopology::GetNodesOfClass(const UClass* NodeClass) const
+{
+	if (const TArray<int32>* ClassNodes = NodesByClass.Find(NodeClass))
+	{
+		return *ClassNodes;
+	}
+
+	return TConstArrayView<int32>();
+}
+
+SIZE_T FFlowGraphTopology::GetAllocatedSize() const
+{
+	SIZE_T Size = ConnectedNodeOffsets.GetAllocatedSize() + ConnectedNodes.GetAllocatedSize()
+		+ ConnectedInputOffsets.GetAllocatedSize() + ConnectedInputs.GetAllocatedSize()
+		+ ExecutionOrders.GetAllocatedSize() + NodesByClass.GetAllocatedSize();
+
+	for (const TPair<int32, TArray<int32>>& ExecutionOrder : ExecutionOrders)
+	{
+		Size += ExecutionOrder.Value.GetAllocatedSize();
+	}
+
+	for (const TPair<const UClass*, TArray<int32>>& ClassNodes : NodesByClass)
+	{
+		Size += ClassNodes.Value.GetAllocatedSize();
+	}
+
+	return Size;
+}
+
 UFlowAsset::UFlowAsset(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, bWorldBound(true)
+	, bInstanceNodesOnDemand(false)
 #if WITH_EDITOR
 	, FlowGraph(nullptr)
+	, bNodeConnectionsDirty(true)
 #endif
 	, AllowedNodeClasses({UFlowNode::StaticClass()})
 	, AllowedInSubgraphNodeClasses({UFlowNode_SubGraph::StaticClass()})
 	, bStartNodePlacedAsGhostNode(false)
+	, bCustomEventsIndexed(false)
 	, TemplateAsset(nullptr)
 	, FinishPolicy(EFlowFinishPolicy::Keep)
+	, bAllNodesInstanced(true)
+	, TimeDilation(1.0f)
+	, bTimersPaused(false)
 {
 	if (!AssetGuid.IsValid())
 	{
@@ -50,6 +230,86 @@ UFlowAsset::UFlowAsset(const FObjectInitializer& ObjectInitializer)
 	ExpectedOwnerClass = UFlowSettings::Get()->GetDefaultExpectedOwnerClass();
 }
 
+void UFlowAsset::Serialize(FArchive& Ar)
+{
+#if WITH_EDITOR
+	// unreachable nodes aren't referenced by the cooked asset, so they're not saved to the cooked package at all
+	if (Ar.IsSaving() && Ar.IsCooking() && UFlowSettings::Get()->bStripUnreachableNodesOnCook)
+	{
+		TSet<FGuid> ReachableNodes;
+		GatherReachableNodes(ReachableNodes);
+
+		if (ReachableNodes.Num() < Nodes.Num())
+		{
+			TMap<FGuid, UFlowNode*> AllNodes = Nodes;
+			for (auto It = Nodes.CreateIterator(); It; ++It)
+			{
+				if (!ReachableNodes.Contains(It.Key()))
+				{
+					It.RemoveCurrent();
+				}
+			}
+
+			Super::Serialize(Ar);
+
+			Nodes = MoveTemp(AllNodes);
+			return;
+		}
+	}
+#endif
+
+	Super::Serialize(Ar);
+}
+
+void UFlowAsset::PostLoad()
+{
+	Super::PostLoad();
+
+#if WITH_EDITOR
+	// If we removed or moved a flow node blueprint (and there is no redirector) we might loose the reference to it resulting
+	// in null pointers in the Nodes FGUID->UFlowNode* Map. So here we iterate over all the Nodes and remove all pairs that
+	// are nulled out.
+	
+	TSet<FGuid> NodesToRemoveGUID;
+
+	for (auto& [Guid, Node] : GetNodes())
+	{
+		if (!IsValid(Node))
+		{
+			NodesToRemoveGUID.Emplace(Guid);
+		}
+	}
+
+	for (const FGuid& Guid : NodesToRemoveGUID)
+	{
+		UnregisterNode(Guid);
+	}
+#endif
+}
+
+void UFlowAsset::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	// reflected properties are already counted by UObject in EstimatedTotal mode
+	if (CumulativeResourceSize.GetResourceSizeMode() == EResourceSizeMode::Exclusive)
+	{
+		CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Nodes.GetAllocatedSize() + ActiveInstances.GetAllocatedSize()
+			+ CustomInputNodes.GetAllocatedSize() + PreloadedNodes.GetAllocatedSize() + ActiveNodes.GetAllocatedSize() + RecordedNodes.GetAllocatedSize());
+	}
+
+	// template caches
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(NodeIndexSpace.GetAllocatedSize() + GraphTopology.GetAllocatedSize()
+		+ CustomInputEvents.GetAllocatedSize() + CustomOutputEvents.GetAllocatedSize());
+
+	// instance routing of custom events and sub graphs
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(ActiveSubGraphs.GetAllocatedSize() + CustomInputNodesByEvent.GetAllocatedSize() + CustomOutputPins.GetAllocatedSize());
+	for (const TArray<UFlowNode_CustomInput*, TInlineAllocator<1>>& EventNodes : CustomInputNodesByEvent)
+	{
+		CumulativeResourceSize.AddDedicatedSystemMemoryBytes(EventNodes.GetAllocatedSize());
+	}
+}
+
 #if WITH_EDITOR
 void UFlowAsset::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
 {
@@ -81,46 +341,83 @@ void UFlowAsset::PostDuplicate(bool bDuplicateForPIE)
 	}
 }
 
-void UFlowAsset::PostLoad()
+void UFlowAsset::PreSave(FObjectPreSaveContext ObjectSaveContext)
 {
-	Super::PostLoad();
+	Super::PreSave(ObjectSaveContext);
 
-	// If we removed or moved a flow node blueprint (and there is no redirector) we might loose the reference to it resulting
-	// in null pointers in the Nodes FGUID->UFlowNode* Map. So here we iterate over all the Nodes and remove all pairs that
-	// are nulled out.
-	
-	TSet<FGuid> NodesToRemoveGUID;
-
-	for (auto& [Guid, Node] : GetNodes())
+	// nodes are stripped by Serialize, editor keeps all of them
+	if (ObjectSaveContext.IsCooking() && UFlowSettings::Get()->bStripUnreachableNodesOnCook)
 	{
-		if (!IsValid(Node))
+		TSet<FGuid> ReachableNodes;
+		GatherReachableNodes(ReachableNodes);
+
+		// rough per-instance cost of node object, excluding allocations owned by node
+		int32 NumUnreachableNodes = 0;
+		SIZE_T SavedBytesPerInstance = 0;
+		for (const TPair<FGuid, UFlowNode*>& Node : Nodes)
 		{
-			NodesToRemoveGUID.Emplace(Guid);
+			if (!ReachableNodes.Contains(Node.Key))
+			{
+				NumUnreachableNodes++;
+				SavedBytesPerInstance += Node.Value ? Node.Value->GetClass()->GetStructureSize() : 0;
+			}
 		}
-	}
 
-	for (const FGuid& Guid : NodesToRemoveGUID)
-	{
-		UnregisterNode(Guid);
+		if (NumUnreachableNodes > 0)
+		{
+			UE_LOG(LogFlow, Display, TEXT("Flow Asset %s: stripped %d of %d nodes unreachable from entry points, saving %llu bytes per instance"),
+				*GetPathName(), NumUnreachableNodes, Nodes.Num(), static_cast<uint64>(SavedBytesPerInstance));
+		}
 	}
 }
 
+FFlowNodeClassRulesCacheScope* FFlowNodeClassRulesCacheScope::ActiveScope = nullptr;
+
+FFlowNodeClassRulesCacheScope::FFlowNodeClassRulesCacheScope()
+	: PreviousScope(ActiveScope)
+{
+	check(IsInGameThread());
+	ActiveScope = this;
+}
+
+FFlowNodeClassRulesCacheScope::~FFlowNodeClassRulesCacheScope()
+{
+	check(ActiveScope == this);
+	ActiveScope = PreviousScope;
+}
+
 EDataValidationResult UFlowAsset::ValidateAsset(FFlowMessageLog& MessageLog)
 {
+	// nodes of the same class share the class checks, the asset reference filter is expensive to create
+	// unset error means the class is allowed
+	TMap<const UClass*, TOptional<FString>> CheckedNodeClasses;
+
 	// validate nodes
 	for (const TPair<FGuid, UFlowNode*>& Node : Nodes)
 	{
 		if (IsValid(Node.Value))
 		{
-			FText FailureReason;
-			if (!IsNodeClassAllowed(Node.Value->GetClass(), &FailureReason))
+			const UClass* NodeClass = Node.Value->GetClass();
+			const TOptional<FString>* ClassError = CheckedNodeClasses.Find(NodeClass);
+			if (ClassError == nullptr)
 			{
-				const FString ErrorMsg = 
-					FailureReason.IsEmpty() ?
-						FString::Format(*ValidationError_NodeClassNotAllowed, {*Node.Value->GetClass()->GetName()}) :
-						FailureReason.ToString();
+				TOptional<FString> NewClassError;
+
+				FText FailureReason;
+				if (!IsNodeClassAllowed(NodeClass, &FailureReason))
+				{
+					NewClassError = 
+						FailureReason.IsEmpty() ?
+							FString::Format(*ValidationError_NodeClassNotAllowed, {*NodeClass->GetName()}) :
+							FailureReason.ToString();
+				}
 
-				MessageLog.Error(*ErrorMsg, Node.Value);
+				ClassError = &CheckedNodeClasses.Add(NodeClass, MoveTemp(NewClassError));
+			}
+
+			if (ClassError->IsSet())
+			{
+				MessageLog.Error(*ClassError->GetValue(), Node.Value);
 			}
 			
 			Node.Value->ValidationLog.Messages.Empty();
@@ -146,18 +443,77 @@ bool UFlowAsset::IsNodeClassAllowed(const UClass* FlowNodeClass, FText* OutOptio
 		return false;
 	}
 
-	if (!CanFlowNodeClassBeUsedByFlowAsset(*FlowNodeClass))
+	if (!AreNodeClassRulesMet(*FlowNodeClass))
 	{
 		return false;
 	}
 
-	if (!CanFlowAssetUseFlowNodeClass(*FlowNodeClass))
+	// Confirm plugin reference restrictions are being respected
+	if (!CanFlowAssetReferenceFlowNode(*FlowNodeClass, OutOptionalFailureReason))
 	{
 		return false;
 	}
 
+	return true;
+}
+
+bool UFlowAsset::IsNodeClassAllowed(const FAssetData& FlowNodeAssetData, const FFlowNodeBlueprintTags& NodeTags, FText* OutOptionalFailureReason) const
+{
+	TArray<FName> AssetClassHierarchy;
+	for (const UClass* Class = GetClass(); Class; Class = Class->GetSuperClass())
+	{
+		AssetClassHierarchy.Emplace(*Class->GetPathName());
+	}
+
+	// same rules as CanFlowNodeClassBeUsedByFlowAsset
+	for (const FName& DeniedAssetClass : NodeTags.DeniedAssetClasses)
+	{
+		if (AssetClassHierarchy.Contains(DeniedAssetClass))
+		{
+			return false;
+		}
+	}
+
+	if (NodeTags.AllowedAssetClasses.Num() > 0)
+	{
+		const bool bAllowedInAsset = NodeTags.AllowedAssetClasses.ContainsByPredicate([&AssetClassHierarchy](const FName& AllowedAssetClass)
+		{
+			return AssetClassHierarchy.Contains(AllowedAssetClass);
+		});
+		if (!bAllowedInAsset)
+		{
+			return false;
+		}
+	}
+
+	// same rules as CanFlowAssetUseFlowNodeClass
+	for (const UClass* DeniedNodeClass : DeniedNodeClasses)
+	{
+		if (DeniedNodeClass && NodeTags.ClassHierarchy.Contains(FName(*DeniedNodeClass->GetPathName())))
+		{
+			return false;
+		}
+	}
+
+	if (AllowedNodeClasses.Num() > 0)
+	{
+		bool bAllowedInAsset = false;
+		for (const UClass* AllowedNodeClass : AllowedNodeClasses)
+		{
+			if (AllowedNodeClass && NodeTags.ClassHierarchy.Contains(FName(*AllowedNodeClass->GetPathName())))
+			{
+				bAllowedInAsset = true;
+				break;
+			}
+		}
+		if (!bAllowedInAsset)
+		{
+			return false;
+		}
+	}
+
 	// Confirm plugin reference restrictions are being respected
-	if (!CanFlowAssetReferenceFlowNode(*FlowNodeClass, OutOptionalFailureReason))
+	if (!CanFlowAssetReferenceFlowNode(FlowNodeAssetData, OutOptionalFailureReason))
 	{
 		return false;
 	}
@@ -165,6 +521,25 @@ bool UFlowAsset::IsNodeClassAllowed(const UClass* FlowNodeClass, FText* OutOptio
 	return true;
 }
 
+bool UFlowAsset::AreNodeClassRulesMet(const UClass& FlowNodeClass) const
+{
+	FFlowNodeClassRulesCacheScope* CacheScope = FFlowNodeClassRulesCacheScope::ActiveScope;
+	if (CacheScope == nullptr)
+	{
+		return CanFlowNodeClassBeUsedByFlowAsset(FlowNodeClass) && CanFlowAssetUseFlowNodeClass(FlowNodeClass);
+	}
+
+	const TPair<FObjectKey, FObjectKey> ClassPair(GetClass(), &FlowNodeClass);
+	if (const bool* CachedResult = CacheScope->Results.Find(ClassPair))
+	{
+		return *CachedResult;
+	}
+
+	const bool bResult = CanFlowNodeClassBeUsedByFlowAsset(FlowNodeClass) && CanFlowAssetUseFlowNodeClass(FlowNodeClass);
+	CacheScope->Results.Add(ClassPair, bResult);
+	return bResult;
+}
+
 bool UFlowAsset::CanFlowNodeClassBeUsedByFlowAsset(const UClass& FlowNodeClass) const
 {
 	UFlowNode* NodeDefaults = FlowNodeClass.GetDefaultObject<UFlowNode>();
@@ -231,12 +606,20 @@ bool UFlowAsset::CanFlowAssetUseFlowNodeClass(const UClass& FlowNodeClass) const
 
 bool UFlowAsset::CanFlowAssetReferenceFlowNode(const UClass& FlowNodeClass, FText* OutOptionalFailureReason) const
 {
-	if (!GEditor || !IsValid(&FlowNodeClass))
+	if (!IsValid(&FlowNodeClass))
 	{
 		return false;
 	}
 
-	FAssetData FlowNodeAssetData(&FlowNodeClass);
+	return CanFlowAssetReferenceFlowNode(FAssetData(&FlowNodeClass), OutOptionalFailureReason);
+}
+
+bool UFlowAsset::CanFlowAssetReferenceFlowNode(const FAssetData& FlowNodeAssetData, FText* OutOptionalFailureReason) const
+{
+	if (!GEditor)
+	{
+		return false;
+	}
 
 	FAssetReferenceFilterContext AssetReferenceFilterContext;
 	AssetReferenceFilterContext.ReferencingAssets.Add(FAssetData(this));
@@ -273,6 +656,10 @@ void UFlowAsset::RegisterNode(const FGuid& NewGuid, UFlowNode* NewNode)
 {
 	NewNode->SetGuid(NewGuid);
 	Nodes.Emplace(NewGuid, NewNode);
+	NodeIndexSpace.Reset();
+	bCanEvaluateInParallel.Reset();
+	bCustomEventsIndexed = false;
+	GraphTopology.Reset();
 
 	HarvestNodeConnections();
 }
@@ -281,84 +668,254 @@ void UFlowAsset::UnregisterNode(const FGuid& NodeGuid)
 {
 	Nodes.Remove(NodeGuid);
 	Nodes.Compact();
+	NodeIndexSpace.Reset();
+	bCanEvaluateInParallel.Reset();
+	bCustomEventsIndexed = false;
+	GraphTopology.Reset();
+
+	HarvestNodeConnections();
+	MarkPackageDirty();
+}
+
+void UFlowAsset::HarvestNodeConnections()
+{
+	TMap<FName, FConnectedPin> Connections;
+	bool bGraphDirty = false;
+
+	// last moment to remove invalid nodes
+	for (auto NodeIt = Nodes.CreateIterator(); NodeIt; ++NodeIt)
+	{
+		const TPair<FGuid, UFlowNode*>& Pair = *NodeIt;
+		if (Pair.Value == nullptr)
+		{
+			NodeIt.RemoveCurrent();
+			bGraphDirty = true;
+		}
+	}
+
+	for (const TPair<FGuid, UFlowNode*>& Pair : Nodes)
+	{
+		UFlowNode* Node = Pair.Value;
+		TMap<FName, FConnectedPin> FoundConnections;
+
+		for (const UEdGraphPin* ThisPin : Node->GetGraphNode()->Pins)
+		{
+			if (ThisPin->Direction == EGPD_Output && ThisPin->LinkedTo.Num() > 0)
+			{
+				if (const UEdGraphPin* LinkedPin = ThisPin->LinkedTo[0])
+				{
+					const UEdGraphNode* LinkedNode = LinkedPin->GetOwningNode();
+					FoundConnections.Add(ThisPin->PinName, FConnectedPin(LinkedNode->NodeGuid, LinkedPin->PinName));
+				}
+			}
+		}
+
+		// This check exists to ensure that we don't mark graph dirty, if none of connections changed
+		// Optimization: we need check it only until the first node would be marked dirty, as this already marks Flow Asset package dirty
+		if (bGraphDirty == false)
+		{
+			if (FoundConnections.Num() != Node->Connections.Num())
+			{
+				bGraphDirty = true;
+			}
+			else
+			{
+				for (const TPair<FName, FConnectedPin>& FoundConnection : FoundConnections)
+				{
+					if (const FConnectedPin* OldConnection = Node->Connections.Find(FoundConnection.Key))
+					{
+						if (FoundConnection.Value != *OldConnection)
+						{
+							bGraphDirty = true;
+							break;
+						}
+					}
+					else
+					{
+						bGraphDirty = true;
+						break;
+					}
+				}
+			}
+		}
+
+		if (bGraphDirty)
+		{
+			Node->SetFlags(RF_Transactional);
+			Node->Modify();
+
+			Node->SetConnections(FoundConnections);
+			Node->PostEditChange();
+		}
+	}
+
+	if (bGraphDirty)
+	{
+		GraphTopology.Reset();
+	}
+
+	bNodeConnectionsDirty = false;
+}
+
+void UFlowAsset::HarvestNodeConnectionsIfDirty()
+{
+	if (bNodeConnectionsDirty)
+	{
+		HarvestNodeConnections();
+	}
+}
+#endif
+
+const TMap<FGuid, UFlowNode*>& UFlowAsset::GetNodes() const
+{
+	if (!bAllNodesInstanced)
+	{
+		// callers enumerating nodes expect all of them
+		const_cast<UFlowAsset*>(this)->CreateRemainingNodeInstances();
+	}
+
+	return Nodes;
+}
+
+UFlowNode* UFlowAsset::GetNode(const FGuid& Guid) const
+{
+	if (UFlowNode* Node = Nodes.FindRef(Guid))
+	{
+		return Node;
+	}
+
+	if (!bAllNodesInstanced)
+	{
+		if (UFlowNode* NodeTemplate = TemplateAsset->Nodes.FindRef(Guid))
+		{
+			return const_cast<UFlowAsset*>(this)->CreateNodeInstance(NodeTemplate);
+		}
+	}
+
+	return nullptr;
+}
+
+const TMap<FGuid, UFlowNode*>& UFlowAsset::GetGraphNodes() const
+{
+	return bAllNodesInstanced ? Nodes : TemplateAsset->Nodes;
+}
+
+const TArray<FGuid>& UFlowAsset::GetNodeIndexSpace() const
+{
+	if (TemplateAsset)
+	{
+		return TemplateAsset->GetNodeIndexSpace();
+	}
+
+	if (NodeIndexSpace.Num() == 0 && Nodes.Num() > 0)
+	{
+		Nodes.GenerateKeyArray(NodeIndexSpace);
+		NodeIndexSpace.Sort();
+	}
+
+	return NodeIndexSpace;
+}
+
+int32 UFlowAsset::GetNodeIndex(const FGuid& Guid) const
+{
+	return Algo::BinarySearch(GetNodeIndexSpace(), Guid);
+}
+
+UFlowNode* UFlowAsset::GetNodeByIndex(const int32 NodeIndex) const
+{
+	const TArray<FGuid>& IndexSpace = GetNodeIndexSpace();
+	return IndexSpace.IsValidIndex(NodeIndex) ? GetNode(IndexSpace[NodeIndex]) : nullptr;
+}
+
+const FFlowGraphTopology& UFlowAsset::GetGraphTopology() const
+{
+	if (TemplateAsset)
+	{
+		return TemplateAsset->GetGraphTopology();
+	}
+
+	if (!GraphTopology.IsBuilt())
+	{
+		TArray<UFlowNode*> EntryNodes;
+		GatherEntryNodes(EntryNodes);
+
+		GraphTopology.Build(GetNodeIndexSpace(), Nodes, EntryNodes);
+	}
+
+	return GraphTopology;
+}
+
+bool UFlowAsset::CanEvaluateInParallel() const
+{
+	if (TemplateAsset)
+	{
+		return TemplateAsset->CanEvaluateInParallel();
+	}
+
+	if (!bCanEvaluateInParallel.IsSet())
+	{
+		// nodes created on demand would be created on worker threads
+		bool bAllNodesThreadSafe = Nodes.Num() > 0 && !bInstanceNodesOnDemand;
+		for (const TPair<FGuid, UFlowNode*>& Node : Nodes)
+		{
+			if (Node.Value == nullptr || !Node.Value->IsThreadSafe())
+			{
+				bAllNodesThreadSafe = false;
+				break;
+			}
+		}
 
-	HarvestNodeConnections();
-	MarkPackageDirty();
+		bCanEvaluateInParallel = bAllNodesThreadSafe;
+	}
+
+	return bCanEvaluateInParallel.GetValue();
 }
 
-void UFlowAsset::HarvestNodeConnections()
+void UFlowAsset::GatherEntryNodes(TArray<UFlowNode*>& OutEntryNodes) const
 {
-	TMap<FName, FConnectedPin> Connections;
-	bool bGraphDirty = false;
+	if (UFlowNode* DefaultEntryNode = GetDefaultEntryNode())
+	{
+		OutEntryNodes.Add(DefaultEntryNode);
+	}
 
-	// last moment to remove invalid nodes
-	for (auto NodeIt = Nodes.CreateIterator(); NodeIt; ++NodeIt)
+	for (const TPair<FGuid, UFlowNode*>& Node : Nodes)
 	{
-		const TPair<FGuid, UFlowNode*>& Pair = *NodeIt;
-		if (Pair.Value == nullptr)
+		const UFlowNode_CustomInput* CustomInput = Cast<UFlowNode_CustomInput>(Node.Value);
+		if (CustomInput && !CustomInput->GetEventName().IsNone())
 		{
-			NodeIt.RemoveCurrent();
-			bGraphDirty = true;
+			OutEntryNodes.Add(Node.Value);
 		}
 	}
+}
 
-	for (const TPair<FGuid, UFlowNode*>& Pair : Nodes)
+void UFlowAsset::GatherReachableNodes(TSet<FGuid>& OutReachableNodes) const
+{
+	TArray<UFlowNode*> NodesToVisit;
+	GatherEntryNodes(NodesToVisit);
+
+	while (NodesToVisit.Num() > 0)
 	{
-		UFlowNode* Node = Pair.Value;
-		TMap<FName, FConnectedPin> FoundConnections;
+		const UFlowNode* Node = NodesToVisit.Pop();
 
-		for (const UEdGraphPin* ThisPin : Node->GetGraphNode()->Pins)
+		bool bAlreadyVisited = false;
+		OutReachableNodes.Add(Node->GetGuid(), &bAlreadyVisited);
+
+		// disabled node still receives the signal, it has to exist to ignore it, but signal never leaves it
+		// pass-through node triggers its outputs, so it's followed like an enabled node
+		if (bAlreadyVisited || Node->SignalMode == EFlowSignalMode::Disabled)
 		{
-			if (ThisPin->Direction == EGPD_Output && ThisPin->LinkedTo.Num() > 0)
-			{
-				if (const UEdGraphPin* LinkedPin = ThisPin->LinkedTo[0])
-				{
-					const UEdGraphNode* LinkedNode = LinkedPin->GetOwningNode();
-					FoundConnections.Add(ThisPin->PinName, FConnectedPin(LinkedNode->NodeGuid, LinkedPin->PinName));
-				}
-			}
+			continue;
 		}
 
-		// This check exists to ensure that we don't mark graph dirty, if none of connections changed
-		// Optimization: we need check it only until the first node would be marked dirty, as this already marks Flow Asset package dirty
-		if (bGraphDirty == false)
+		for (const TPair<FName, FConnectedPin>& Connection : Node->Connections)
 		{
-			if (FoundConnections.Num() != Node->Connections.Num())
-			{
-				bGraphDirty = true;
-			}
-			else
+			if (UFlowNode* ConnectedNode = Nodes.FindRef(Connection.Value.NodeGuid))
 			{
-				for (const TPair<FName, FConnectedPin>& FoundConnection : FoundConnections)
-				{
-					if (const FConnectedPin* OldConnection = Node->Connections.Find(FoundConnection.Key))
-					{
-						if (FoundConnection.Value != *OldConnection)
-						{
-							bGraphDirty = true;
-							break;
-						}
-					}
-					else
-					{
-						bGraphDirty = true;
-						break;
-					}
-				}
+				NodesToVisit.Add(ConnectedNode);
 			}
 		}
-
-		if (bGraphDirty)
-		{
-			Node->SetFlags(RF_Transactional);
-			Node->Modify();
-
-			Node->SetConnections(FoundConnections);
-			Node->PostEditChange();
-		}
 	}
 }
-#endif
 
 UFlowNode* UFlowAsset::GetDefaultEntryNode() const
 {
@@ -368,7 +925,7 @@ UFlowNode* UFlowAsset::GetDefaultEntryNode() const
 	{
 		if (UFlowNode_Start* StartNode = Cast<UFlowNode_Start>(Node.Value))
 		{
-			if (StartNode->GetConnectedNodes().Num() > 0)
+			if (StartNode->Connections.Num() > 0)
 			{
 				return StartNode;
 			}
@@ -432,13 +989,13 @@ UFlowNode_CustomInput* UFlowAsset::TryFindCustomInputNodeByEventName(const FName
 
 UFlowNode_CustomOutput* UFlowAsset::TryFindCustomOutputNodeByEventName(const FName& EventName) const
 {
-	for (const TPair<FGuid, UFlowNode*>& Node : Nodes)
+	for (const TPair<FGuid, UFlowNode*>& Node : GetGraphNodes())
 	{
-		if (UFlowNode_CustomOutput* CustomOutput = Cast<UFlowNode_CustomOutput>(Node.Value))
+		if (const UFlowNode_CustomOutput* CustomOutput = Cast<UFlowNode_CustomOutput>(Node.Value))
 		{
 			if (CustomOutput->GetEventName() == EventName)
 			{
-				return CustomOutput;
+				return Cast<UFlowNode_CustomOutput>(GetNode(Node.Key));
 			}
 		}
 	}
@@ -452,7 +1009,7 @@ TArray<FName> UFlowAsset::GatherCustomInputNodeEventNames() const
 	//  from the actual flow nodes
 	TArray<FName> Results;
 
-	for (const TPair<FGuid, UFlowNode*>& Node : Nodes)
+	for (const TPair<FGuid, UFlowNode*>& Node : GetGraphNodes())
 	{
 		if (UFlowNode_CustomInput* CustomInput = Cast<UFlowNode_CustomInput>(Node.Value))
 		{
@@ -469,7 +1026,7 @@ TArray<FName> UFlowAsset::GatherCustomOutputNodeEventNames() const
 	//  from the actual flow nodes
 	TArray<FName> Results;
 
-	for (const TPair<FGuid, UFlowNode*>& Node : Nodes)
+	for (const TPair<FGuid, UFlowNode*>& Node : GetGraphNodes())
 	{
 		if (UFlowNode_CustomOutput* CustomOutput = Cast<UFlowNode_CustomOutput>(Node.Value))
 		{
@@ -480,19 +1037,72 @@ TArray<FName> UFlowAsset::GatherCustomOutputNodeEventNames() const
 	return Results;
 }
 
+const FFlowCustomEventIndex& UFlowAsset::GetCustomInputEvents() const
+{
+	if (TemplateAsset)
+	{
+		return TemplateAsset->GetCustomInputEvents();
+	}
+
+	if (!bCustomEventsIndexed)
+	{
+		IndexCustomEvents();
+	}
+
+	return CustomInputEvents;
+}
+
+const FFlowCustomEventIndex& UFlowAsset::GetCustomOutputEvents() const
+{
+	if (TemplateAsset)
+	{
+		return TemplateAsset->GetCustomOutputEvents();
+	}
+
+	if (!bCustomEventsIndexed)
+	{
+		IndexCustomEvents();
+	}
+
+	return CustomOutputEvents;
+}
+
+void UFlowAsset::IndexCustomEvents() const
+{
+	CustomInputEvents.Reset();
+	CustomOutputEvents.Reset();
+
+	for (const TPair<FGuid, UFlowNode*>& Node : Nodes)
+	{
+		if (const UFlowNode_CustomInput* CustomInput = Cast<UFlowNode_CustomInput>(Node.Value))
+		{
+			if (!CustomInput->GetEventName().IsNone())
+			{
+				CustomInputEvents.Add(CustomInput->GetEventName());
+			}
+		}
+		else if (const UFlowNode_CustomOutput* CustomOutput = Cast<UFlowNode_CustomOutput>(Node.Value))
+		{
+			if (!CustomOutput->GetEventName().IsNone())
+			{
+				CustomOutputEvents.Add(CustomOutput->GetEventName());
+			}
+		}
+	}
+
+	bCustomEventsIndexed = true;
+}
+
 TArray<UFlowNode*> UFlowAsset::GetNodesInExecutionOrder(UFlowNode* FirstIteratedNode, const TSubclassOf<UFlowNode> FlowNodeClass)
 {
 	TArray<UFlowNode*> FoundNodes;
 	GetNodesInExecutionOrder<UFlowNode>(FirstIteratedNode, FoundNodes);
 
 	// filter out nodes by class
-	for (int32 i = FoundNodes.Num() - 1; i >= 0; i--)
+	FoundNodes.RemoveAll([&FlowNodeClass](const UFlowNode* Node)
 	{
-		if (!FoundNodes[i]->GetClass()->IsChildOf(FlowNodeClass))
-		{
-			FoundNodes.RemoveAt(i);
-		}
-	}
+		return !Node->GetClass()->IsChildOf(FlowNodeClass);
+	});
 	FoundNodes.Shrink();
 	
 	return FoundNodes;
@@ -513,6 +1123,14 @@ int32 UFlowAsset::RemoveInstance(UFlowAsset* Instance)
 #endif
 
 	ActiveInstances.Remove(Instance);
+
+	if (ActiveInstances.Num() == 0)
+	{
+		// template might be edited before creating next instance
+		bCustomEventsIndexed = false;
+		GraphTopology.Reset();
+	}
+
 	return ActiveInstances.Num();
 }
 
@@ -545,6 +1163,52 @@ void UFlowAsset::GetInstanceDisplayNames(TArray<TSharedPtr<FName>>& OutDisplayNa
 	}
 }
 
+// Reports triggered pins to the graph editor, the inspected instance also records pin activations
+class FFlowInspectionObserver final : public IFlowInstanceObserver
+{
+public:
+	explicit FFlowInspectionObserver(const bool bInRecordPins)
+		: bRecordPins(bInRecordPins)
+	{
+	}
+
+	virtual void OnInputTriggered(UFlowNode& Node, const int32 PinIndex, const EFlowPinActivationType ActivationType) override
+	{
+		if (bRecordPins)
+		{
+			Node.InputRecords.FindOrAdd(Node.InputPins[PinIndex].PinName).Add(FPinRecord(FApp::GetCurrentTime(), ActivationType));
+		}
+
+		UFlowSubsystem::RunOnGameThread([WeakNode = TWeakObjectPtr<UFlowNode>(&Node), PinIndex]()
+		{
+			if (WeakNode.IsValid() && UFlowAsset::GetFlowGraphInterface().IsValid())
+			{
+				UFlowAsset::GetFlowGraphInterface()->OnInputTriggered(WeakNode->GraphNode, PinIndex);
+			}
+		});
+	}
+
+	virtual void OnOutputTriggered(UFlowNode& Node, const int32 PinIndex, const EFlowPinActivationType ActivationType) override
+	{
+		// record for debugging, even if nothing is connected to this pin
+		if (bRecordPins)
+		{
+			Node.OutputRecords.FindOrAdd(Node.OutputPins[PinIndex].PinName).Add(FPinRecord(FApp::GetCurrentTime(), ActivationType));
+		}
+
+		UFlowSubsystem::RunOnGameThread([WeakNode = TWeakObjectPtr<UFlowNode>(&Node), PinIndex]()
+		{
+			if (WeakNode.IsValid() && UFlowAsset::GetFlowGraphInterface().IsValid())
+			{
+				UFlowAsset::GetFlowGraphInterface()->OnOutputTriggered(WeakNode->GraphNode, PinIndex);
+			}
+		});
+	}
+
+private:
+	const bool bRecordPins;
+};
+
 void UFlowAsset::SetInspectedInstance(const FName& NewInspectedInstanceName)
 {
 	if (NewInspectedInstanceName.IsNone())
@@ -566,9 +1230,37 @@ void UFlowAsset::SetInspectedInstance(const FName& NewInspectedInstanceName)
 		}
 	}
 
+	RefreshInstanceObservers();
 	BroadcastDebuggerRefresh();
 }
 
+void UFlowAsset::RefreshInstanceObservers()
+{
+	// instances without an observer skip all debugging hooks, only the inspected instance pays for recording pin activations
+	TSharedPtr<IFlowInstanceObserver> BreakpointObserver;
+	if (FlowGraphInterface.IsValid() && FlowGraphInterface->HasBreakpoints(*this))
+	{
+		BreakpointObserver = MakeShared<FFlowInspectionObserver>(false);
+	}
+
+	for (UFlowAsset* ActiveInstance : ActiveInstances)
+	{
+		if (ActiveInstance == nullptr)
+		{
+			continue;
+		}
+
+		if (ActiveInstance == InspectedInstance.Get())
+		{
+			ActiveInstance->SetInstanceObserver(MakeShared<FFlowInspectionObserver>(true));
+		}
+		else
+		{
+			ActiveInstance->SetInstanceObserver(BreakpointObserver);
+		}
+	}
+}
+
 void UFlowAsset::BroadcastDebuggerRefresh() const
 {
 	RefreshDebuggerEvent.Broadcast();
@@ -585,21 +1277,62 @@ void UFlowAsset::InitializeInstance(const TWeakObjectPtr<UObject> InOwner, UFlow
 	Owner = InOwner;
 	TemplateAsset = InTemplateAsset;
 
-	for (TPair<FGuid, UFlowNode*>& Node : Nodes)
+	CustomInputNodesByEvent.SetNum(GetCustomInputEvents().EventNames.Num());
+
+	// nodes might query it on worker threads
+	GetGraphTopology();
+
+	if (TemplateAsset->bInstanceNodesOnDemand)
 	{
-		UFlowNode* NewNodeInstance = NewObject<UFlowNode>(this, Node.Value->GetClass(), NAME_None, RF_Transient, Node.Value, false, nullptr);
-		Node.Value = NewNodeInstance;
+		// only entry nodes are needed to start the graph
+		Nodes.Reset();
+		bAllNodesInstanced = false;
 
-		if (UFlowNode_CustomInput* CustomInput = Cast<UFlowNode_CustomInput>(NewNodeInstance))
+		TArray<UFlowNode*> EntryNodes;
+		TemplateAsset->GatherEntryNodes(EntryNodes);
+		for (UFlowNode* EntryNode : EntryNodes)
 		{
-			if (!CustomInput->EventName.IsNone())
-			{
-				CustomInputNodes.Emplace(CustomInput);
-			}
+			CreateNodeInstance(EntryNode);
+		}
+	}
+	else
+	{
+		for (const TPair<FGuid, UFlowNode*>& Node : TemplateAsset->Nodes)
+		{
+			CreateNodeInstance(Node.Value);
+		}
+	}
+}
+
+UFlowNode* UFlowAsset::CreateNodeInstance(UFlowNode* NodeTemplate)
+{
+	UFlowNode* NewNodeInstance = NewObject<UFlowNode>(this, NodeTemplate->GetClass(), NAME_None, RF_Transient, NodeTemplate, false, nullptr);
+	Nodes.Add(NodeTemplate->GetGuid(), NewNodeInstance);
+
+	if (UFlowNode_CustomInput* CustomInput = Cast<UFlowNode_CustomInput>(NewNodeInstance))
+	{
+		if (!CustomInput->EventName.IsNone())
+		{
+			CustomInputNodes.Emplace(CustomInput);
+			CustomInputNodesByEvent[GetCustomInputEvents().Find(CustomInput->EventName)].Add(CustomInput);
 		}
+	}
+
+	NewNodeInstance->InitializeInstance();
+	return NewNodeInstance;
+}
 
-		NewNodeInstance->InitializeInstance();
+void UFlowAsset::CreateRemainingNodeInstances()
+{
+	for (const TPair<FGuid, UFlowNode*>& Node : TemplateAsset->Nodes)
+	{
+		if (!Nodes.Contains(Node.Key))
+		{
+			CreateNodeInstance(Node.Value);
+		}
 	}
+
+	bAllNodesInstanced = true;
 }
 
 void UFlowAsset::DeinitializeInstance()
@@ -634,6 +1367,8 @@ void UFlowAsset::PreStartFlow()
 	}
 	else
 	{
+		TemplateAsset->RefreshInstanceObservers();
+
 		// request to refresh list to show newly created instance
 		TemplateAsset->BroadcastDebuggerRefresh();
 	}
@@ -649,6 +1384,8 @@ void UFlowAsset::StartFlow()
 		RecordedNodes.Add(ConnectedEntryNode);
 		ConnectedEntryNode->TriggerFirstOutput(true);
 	}
+
+	MarkReplicatedStateDirty();
 }
 
 void UFlowAsset::FinishFlow(const EFlowFinishPolicy InFinishPolicy, const bool bRemoveInstance /*= true*/)
@@ -661,6 +1398,7 @@ void UFlowAsset::FinishFlow(const EFlowFinishPolicy InFinishPolicy, const bool b
 		Node->Deactivate();
 	}
 	ActiveNodes.Empty();
+	MarkReplicatedStateDirty();
 
 	// flush preloaded content
 	for (UFlowNode* PreloadedNode : PreloadedNodes)
@@ -699,23 +1437,29 @@ TWeakObjectPtr<UFlowAsset> UFlowAsset::GetFlowInstance(UFlowNode_SubGraph* SubGr
 
 void UFlowAsset::TriggerCustomInput_FromSubGraph(UFlowNode_SubGraph* Node, const FName& EventName) const
 {
-	const TWeakObjectPtr<UFlowAsset> FlowInstance = ActiveSubGraphs.FindRef(Node);
-	if (FlowInstance.IsValid())
+	if (Node->SubFlowInstance.IsValid())
 	{
-		FlowInstance->TriggerCustomInput(EventName);
+		Node->SubFlowInstance->TriggerCustomInput(EventName);
 	}
 }
 
 void UFlowAsset::TriggerCustomInput(const FName& EventName)
 {
-	for (UFlowNode_CustomInput* CustomInput : CustomInputNodes)
+	TriggerCustomInputByIndex(GetCustomInputEvents().Find(EventName));
+}
+
+void UFlowAsset::TriggerCustomInputByIndex(const int32 EventIndex)
+{
+	if (CustomInputNodesByEvent.IsValidIndex(EventIndex))
 	{
-		if (CustomInput->EventName == EventName)
+		for (UFlowNode_CustomInput* CustomInput : CustomInputNodesByEvent[EventIndex])
 		{
 			RecordedNodes.Add(CustomInput);
-			CustomInput->ExecuteInput(EventName);
+			CustomInput->ExecuteInput(CustomInput->EventName);
 		}
 	}
+
+	MarkReplicatedStateDirty();
 }
 
 void UFlowAsset::TriggerCustomOutput(const FName& EventName)
@@ -726,21 +1470,74 @@ void UFlowAsset::TriggerCustomOutput(const FName& EventName)
 	}
 	else // it's a Root Flow, so the intention here might be to call event on the Flow Component
 	{
-		if (UFlowComponent* FlowComponent = Cast<UFlowComponent>(GetOwner()))
+		UFlowSubsystem::RunOnGameThread([WeakThis = TWeakObjectPtr<UFlowAsset>(this), EventName]()
 		{
-			FlowComponent->OnTriggerRootFlowOutputEventDispatcher(this, EventName);
-		}
+			if (WeakThis.IsValid())
+			{
+				if (UFlowComponent* FlowComponent = Cast<UFlowComponent>(WeakThis->GetOwner()))
+				{
+					FlowComponent->OnTriggerRootFlowOutputEventDispatcher(WeakThis.Get(), EventName);
+				}
+			}
+		});
+	}
+}
+
+void UFlowAsset::TriggerCustomOutputByIndex(const int32 EventIndex)
+{
+	const int32 PinIndex = CustomOutputPins.IsValidIndex(EventIndex) ? CustomOutputPins[EventIndex] : INDEX_NONE;
+	if (PinIndex != INDEX_NONE && NodeOwningThisAssetInstance.IsValid())
+	{
+		NodeOwningThisAssetInstance->TriggerOutputByIndex(PinIndex);
+	}
+	else if (GetCustomOutputEvents().EventNames.IsValidIndex(EventIndex))
+	{
+		// Root Flow or SubGraph node without matching pin, handled by name
+		TriggerCustomOutput(GetCustomOutputEvents().EventNames[EventIndex]);
+	}
+}
+
+void UFlowAsset::AttachToSubGraph(UFlowNode_SubGraph* SubGraphNode)
+{
+	NodeOwningThisAssetInstance = SubGraphNode;
+	SubGraphNode->SubFlowInstance = this;
+
+	const TArray<FName>& OutputEvents = GetCustomOutputEvents().EventNames;
+	CustomOutputPins.SetNumUninitialized(OutputEvents.Num());
+	for (int32 EventIndex = 0; EventIndex < OutputEvents.Num(); EventIndex++)
+	{
+		CustomOutputPins[EventIndex] = SubGraphNode->OutputPins.IndexOfByKey(OutputEvents[EventIndex]);
+	}
+
+	const FFlowCustomEventIndex& InputEvents = GetCustomInputEvents();
+	SubGraphNode->InputPinEvents.SetNumUninitialized(SubGraphNode->InputPins.Num());
+	for (int32 PinIndex = 0; PinIndex < SubGraphNode->InputPins.Num(); PinIndex++)
+	{
+		SubGraphNode->InputPinEvents[PinIndex] = InputEvents.Find(SubGraphNode->InputPins[PinIndex].PinName);
+	}
+}
+
+void UFlowAsset::DetachFromSubGraph()
+{
+	if (NodeOwningThisAssetInstance.IsValid())
+	{
+		NodeOwningThisAssetInstance->SubFlowInstance.Reset();
+		NodeOwningThisAssetInstance->InputPinEvents.Reset();
 	}
+
+	NodeOwningThisAssetInstance = nullptr;
+	CustomOutputPins.Reset();
 }
 
 void UFlowAsset::TriggerInput(const FGuid& NodeGuid, const FName& PinName)
 {
-	if (UFlowNode* Node = Nodes.FindRef(NodeGuid))
+	if (UFlowNode* Node = GetNode(NodeGuid))
 	{
 		if (!ActiveNodes.Contains(Node))
 		{
 			ActiveNodes.Add(Node);
 			RecordedNodes.Add(Node);
+			MarkReplicatedStateDirty();
 		}
 
 		Node->TriggerInput(PinName);
@@ -752,6 +1549,7 @@ void UFlowAsset::FinishNode(UFlowNode* Node)
 	if (ActiveNodes.Contains(Node))
 	{
 		ActiveNodes.Remove(Node);
+		MarkReplicatedStateDirty();
 
 		// if graph reached Finish and this asset instance was created by SubGraph node
 		if (Node->CanFinishGraph())
@@ -762,7 +1560,14 @@ void UFlowAsset::FinishNode(UFlowNode* Node)
 			}
 			else
 			{
-				FinishFlow(EFlowFinishPolicy::Keep);
+				// finishing Root Flow modifies its template and the Flow Subsystem
+				UFlowSubsystem::RunOnGameThread([WeakThis = TWeakObjectPtr<UFlowAsset>(this)]()
+				{
+					if (WeakThis.IsValid())
+					{
+						WeakThis->FinishFlow(EFlowFinishPolicy::Keep);
+					}
+				});
 			}
 		}
 	}
@@ -798,6 +1603,63 @@ UFlowAsset* UFlowAsset::GetParentInstance() const
 	return NodeOwningThisAssetInstance.IsValid() ? NodeOwningThisAssetInstance.Get()->GetFlowAsset() : nullptr;
 }
 
+void UFlowAsset::SetTimeDilation(const float NewTimeDilation)
+{
+	TimeDilation = FMath::Max(0.0f, NewTimeDilation);
+
+	if (UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
+	{
+		FlowSubsystem->GetFlowTimers().RefreshInstanceTimers(this);
+	}
+}
+
+void UFlowAsset::SetTimersPaused(const bool bPaused)
+{
+	bTimersPaused = bPaused;
+
+	if (UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
+	{
+		FlowSubsystem->GetFlowTimers().RefreshInstanceTimers(this);
+	}
+}
+
+float UFlowAsset::GetTimeDilation() const
+{
+	const UFlowAsset* ParentInstance = GetParentInstance();
+	return ParentInstance ? TimeDilation * ParentInstance->GetTimeDilation() : TimeDilation;
+}
+
+bool UFlowAsset::AreTimersPaused() const
+{
+	const UFlowAsset* ParentInstance = GetParentInstance();
+	return bTimersPaused || (ParentInstance && ParentInstance->AreTimersPaused());
+}
+
+void UFlowAsset::MarkReplicatedStateDirty() const
+{
+	// Sub Graphs aren't replicated, their progress is visible as the state of Sub Graph node
+	if (!NodeOwningThisAssetInstance.IsValid())
+	{
+		if (UFlowComponent* FlowComponent = Cast<UFlowComponent>(GetOwner()))
+		{
+			if (UFlowSubsystem::IsInParallelEvaluation())
+			{
+				UFlowSubsystem::RunOnGameThread([WeakComponent = TWeakObjectPtr<UFlowComponent>(FlowComponent)]()
+				{
+					if (WeakComponent.IsValid())
+					{
+						WeakComponent->MarkRootFlowStateDirty();
+					}
+				});
+			}
+			else
+			{
+				FlowComponent->MarkRootFlowStateDirty();
+			}
+		}
+	}
+}
+
 FFlowAssetSaveData UFlowAsset::SaveInstance(TArray<FFlowAssetSaveData>& SavedFlowInstances)
 {
 	FFlowAssetSaveData AssetRecord;
@@ -809,7 +1671,20 @@ FFlowAssetSaveData UFlowAsset::SaveInstance(TArray<FFlowAssetSaveData>& SavedFlo
 
 	// iterate nodes
 	TArray<UFlowNode*> NodesInExecutionOrder;
-	GetNodesInExecutionOrder<UFlowNode>(GetDefaultEntryNode(), NodesInExecutionOrder);
+	if (bAllNodesInstanced)
+	{
+		GetNodesInExecutionOrder<UFlowNode>(GetDefaultEntryNode(), NodesInExecutionOrder);
+	}
+	else
+	{
+		// follow the template graph, only already created nodes might be active
+		TemplateAsset->GetNodesInExecutionOrder<UFlowNode>(TemplateAsset->GetDefaultEntryNode(), NodesInExecutionOrder);
+		for (UFlowNode*& Node : NodesInExecutionOrder)
+		{
+			Node = Nodes.FindRef(Node->GetGuid());
+		}
+	}
+
 	for (UFlowNode* Node : NodesInExecutionOrder)
 	{
 		if (Node && Node->ActivationState == EFlowNodeState::Active)
@@ -855,13 +1730,14 @@ void UFlowAsset::LoadInstance(const FFlowAssetSaveData& AssetRecord)
 	// prevents issue when the preceding node would instantly fire output to a not-yet-loaded node
 	for (int32 i = AssetRecord.NodeRecords.Num() - 1; i >= 0; i--)
 	{
-		if (UFlowNode* Node = Nodes.FindRef(AssetRecord.NodeRecords[i].NodeGuid))
+		if (UFlowNode* Node = GetNode(AssetRecord.NodeRecords[i].NodeGuid))
 		{
 			Node->LoadInstance(AssetRecord.NodeRecords[i]);
 		}
 	}
 
 	OnLoad();
+	MarkReplicatedStateDirty();
 }
 
 void UFlowAsset::OnActivationStateLoaded(UFlowNode* Node)
@@ -11,18 +11,25 @@
 #include "Engine/GameInstance.h"
 #include "Engine/ViewportStatsSubsystem.h"
 #include "Engine/World.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Net/UnrealNetwork.h"
+#include "TimerManager.h"
 #include "Serialization/MemoryReader.h"
 #include "Serialization/MemoryWriter.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowComponent)
 
+#if WITH_EDITOR
+FNativeFlowComponentEvent UFlowComponent::OnRootFlowStatesReplicatedNative;
+#endif
+
 UFlowComponent::UFlowComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, RootFlow(nullptr)
 	, bAutoStartRootFlow(true)
 	, RootFlowMode(EFlowNetMode::Authority)
 	, bAllowMultipleInstances(true)
+	, bReplicateRootFlowState(false)
 {
 	PrimaryComponentTick.bCanEverTick = false;
 	PrimaryComponentTick.bStartWithTickEnabled = false;
@@ -30,22 +37,34 @@ UFlowComponent::UFlowComponent(const FObjectInitializer& ObjectInitializer)
 	SetIsReplicatedByDefault(true);
 }
 
+void UFlowComponent::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	ReplicatedIdentityTags.Owner = this;
+	NotifyLog.Owner = this;
+}
+
 void UFlowComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(UFlowComponent, AddedIdentityTags);
-	DOREPLIFETIME(UFlowComponent, RemovedIdentityTags);
+	// properties are marked dirty only when changed, so idle components don't cost anything on server
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
 
-	DOREPLIFETIME(UFlowComponent, RecentlySentNotifyTags);
-	DOREPLIFETIME(UFlowComponent, NotifyTagsFromGraph);
-	DOREPLIFETIME(UFlowComponent, NotifyTagsFromAnotherComponent);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UFlowComponent, ReplicatedIdentityTags, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UFlowComponent, NotifyLog, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UFlowComponent, RootFlowStates, Params);
 }
 
 void UFlowComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// tags assigned before Begin Play weren't replicated yet
+	ReplicateIdentityTagsAdded(IdentityTags);
+
 	RegisterWithFlowSubsystem();
 }
 
@@ -106,10 +125,7 @@ void UFlowComponent::AddIdentityTag(const FGameplayTag Tag, const EFlowNetMode N
 				FlowSubsystem->OnIdentityTagAdded(this, Tag);
 			}
 
-			if (IsNetMode(NM_DedicatedServer) || IsNetMode(NM_ListenServer))
-			{
-				AddedIdentityTags = FGameplayTagContainer(Tag);
-			}
+			ReplicateIdentityTagsAdded(FGameplayTagContainer(Tag));
 		}
 	}
 }
@@ -138,10 +154,7 @@ void UFlowComponent::AddIdentityTags(FGameplayTagContainer Tags, const EFlowNetM
 				FlowSubsystem->OnIdentityTagsAdded(this, ValidatedTags);
 			}
 
-			if (IsNetMode(NM_DedicatedServer) || IsNetMode(NM_ListenServer))
-			{
-				AddedIdentityTags = ValidatedTags;
-			}
+			ReplicateIdentityTagsAdded(ValidatedTags);
 		}
 	}
 }
@@ -161,10 +174,7 @@ void UFlowComponent::RemoveIdentityTag(const FGameplayTag Tag, const EFlowNetMod
 				FlowSubsystem->OnIdentityTagRemoved(this, Tag);
 			}
 
-			if (IsNetMode(NM_DedicatedServer) || IsNetMode(NM_ListenServer))
-			{
-				RemovedIdentityTags = FGameplayTagContainer(Tag);
-			}
+			ReplicateIdentityTagsRemoved(FGameplayTagContainer(Tag));
 		}
 	}
 }
@@ -193,33 +203,89 @@ void UFlowComponent::RemoveIdentityTags(FGameplayTagContainer Tags, const EFlowN
 				FlowSubsystem->OnIdentityTagsRemoved(this, ValidatedTags);
 			}
 
-			if (IsNetMode(NM_DedicatedServer) || IsNetMode(NM_ListenServer))
-			{
-				RemovedIdentityTags = ValidatedTags;
-			}
+			ReplicateIdentityTagsRemoved(ValidatedTags);
 		}
 	}
 }
 
-void UFlowComponent::OnRep_AddedIdentityTags()
+void UFlowComponent::ReplicateIdentityTagsAdded(const FGameplayTagContainer& AddedTags)
 {
-	IdentityTags.AppendTags(AddedIdentityTags);
-	OnIdentityTagsAdded.Broadcast(this, AddedIdentityTags);
+	if (IsNetMode(NM_DedicatedServer) || IsNetMode(NM_ListenServer))
+	{
+		bool bChanged = false;
+		for (const FGameplayTag& Tag : AddedTags)
+		{
+			bChanged |= ReplicatedIdentityTags.AddTag(Tag);
+		}
 
-	if (UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
+		if (bChanged)
+		{
+			MARK_PROPERTY_DIRTY_FROM_NAME(UFlowComponent, ReplicatedIdentityTags, this);
+		}
+	}
+}
+
+void UFlowComponent::ReplicateIdentityTagsRemoved(const FGameplayTagContainer& RemovedTags)
+{
+	if (IsNetMode(NM_DedicatedServer) || IsNetMode(NM_ListenServer))
+	{
+		bool bChanged = false;
+		for (const FGameplayTag& Tag : RemovedTags)
+		{
+			bChanged |= ReplicatedIdentityTags.RemoveTag(Tag);
+		}
+
+		if (bChanged)
+		{
+			MARK_PROPERTY_DIRTY_FROM_NAME(UFlowComponent, ReplicatedIdentityTags, this);
+		}
+	}
+}
+
+void UFlowComponent::OnReplicatedIdentityTagsAdded(const FGameplayTagContainer& AddedTags)
+{
+	FGameplayTagContainer ValidatedTags;
+	for (const FGameplayTag& Tag : AddedTags)
+	{
+		if (Tag.IsValid() && !IdentityTags.HasTagExact(Tag))
+		{
+			IdentityTags.AddTag(Tag);
+			ValidatedTags.AddTag(Tag);
+		}
+	}
+
+	// before Begin Play, component will be registered with all its current tags
+	if (ValidatedTags.Num() > 0 && HasBegunPlay())
 	{
-		FlowSubsystem->OnIdentityTagsAdded(this, AddedIdentityTags);
+		OnIdentityTagsAdded.Broadcast(this, ValidatedTags);
+
+		if (UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
+		{
+			FlowSubsystem->OnIdentityTagsAdded(this, ValidatedTags);
+		}
 	}
 }
 
-void UFlowComponent::OnRep_RemovedIdentityTags()
+void UFlowComponent::OnReplicatedIdentityTagsRemoved(const FGameplayTagContainer& RemovedTags)
 {
-	IdentityTags.RemoveTags(RemovedIdentityTags);
-	OnIdentityTagsRemoved.Broadcast(this, RemovedIdentityTags);
+	FGameplayTagContainer ValidatedTags;
+	for (const FGameplayTag& Tag : RemovedTags)
+	{
+		if (Tag.IsValid() && IdentityTags.HasTagExact(Tag))
+		{
+			IdentityTags.RemoveTag(Tag);
+			ValidatedTags.AddTag(Tag);
+		}
+	}
 
-	if (UFlowSubsystem* FlowSubsystem = GetWorld()->GetGameInstance()->GetSubsystem<UFlowSubsystem>())
+	if (ValidatedTags.Num() > 0 && HasBegunPlay())
 	{
-		FlowSubsystem->OnIdentityTagsRemoved(this, RemovedIdentityTags);
+		OnIdentityTagsRemoved.Broadcast(this, ValidatedTags);
+
+		if (UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
+		{
+			FlowSubsystem->OnIdentityTagsRemoved(this, ValidatedTags);
+		}
 	}
 }
 
@@ -260,15 +326,83 @@ void UFlowComponent::LogError(FString Message, const EFlowOnScreenMessageType On
 	UE_LOG(LogFlow, Error, TEXT("%s"), *Message);
 }
 
+bool UFlowComponent::ShouldReplicateNotifies() const
+{
+	return IsNetMode(NM_DedicatedServer) || IsNetMode(NM_ListenServer);
+}
+
+void UFlowComponent::ServerSetNotifyInterest_Implementation(const FFlowNotifyInterest& Interest)
+{
+	const UFlowSettings* Settings = UFlowSettings::Get();
+	UFlowSubsystem* FlowSubsystem = GetFlowSubsystem();
+	if (FlowSubsystem == nullptr || !Settings->bFilterNotifiesByClientInterest)
+	{
+		return;
+	}
+
+	// interest comes from the client, it's stored for the whole connection lifetime and checked for every replicated notify
+	if (Interest.IdentityTags.Num() + Interest.NotifyTags.Num() > Settings->MaxNotifyInterestTags)
+	{
+		UE_LOG(LogFlow, Warning, TEXT("%s: ignored notify interest with %d tags, limit is %d"), *GetPathName(), Interest.IdentityTags.Num() + Interest.NotifyTags.Num(), Settings->MaxNotifyInterestTags);
+		return;
+	}
+
+	if (Settings->NotifyInterestTagRoots.Num() > 0)
+	{
+		for (const FGameplayTag& NotifyTag : Interest.NotifyTags)
+		{
+			if (!NotifyTag.MatchesAny(Settings->NotifyInterestTagRoots))
+			{
+				UE_LOG(LogFlow, Warning, TEXT("%s: ignored notify interest with tag %s outside of Notify Interest Tag Roots"), *GetPathName(), *NotifyTag.ToString());
+				return;
+			}
+		}
+	}
+
+	FlowSubsystem->SetConnectionNotifyInterest(GetOwner()->GetNetConnection(), Interest);
+}
+
+void UFlowComponent::ReplicateNotify(const EFlowNotifyChannel Channel, const FGameplayTag& NotifyTag, const FGameplayTag& ActorTag /* = FGameplayTag()*/)
+{
+	NotifyLog.AddNotify(Channel, NotifyTag, ActorTag);
+	MARK_PROPERTY_DIRTY_FROM_NAME(UFlowComponent, NotifyLog, this);
+}
+
+void UFlowComponent::OnNotifiesReplicated(const TConstArrayView<FFlowNotifyLogEntry> Entries)
+{
+	// entries are broadcast one by one in the order of sending, repeated notifies included
+	for (const FFlowNotifyLogEntry& Entry : Entries)
+	{
+		switch (Entry.Channel)
+		{
+			case EFlowNotifyChannel::FromComponent:
+				RecentlySentNotifyTags = FGameplayTagContainer(Entry.NotifyTag);
+				BroadcastSentNotifyTags();
+				break;
+			case EFlowNotifyChannel::FromGraph:
+				ReceiveNotify.Broadcast(nullptr, Entry.NotifyTag);
+				break;
+			case EFlowNotifyChannel::ToActor:
+				BroadcastNotifyToActors(Entry.ActorTag, Entry.NotifyTag);
+				break;
+			default: ;
+		}
+	}
+}
+
 void UFlowComponent::NotifyGraph(const FGameplayTag NotifyTag, const EFlowNetMode NetMode /* = EFlowNetMode::Authority*/)
 {
 	if (IsFlowNetMode(NetMode) && NotifyTag.IsValid() && HasBegunPlay())
 	{
 		// save recently notify, this allow for the retroactive check in nodes
-		// if retroactive check wouldn't be performed, this is only used by the network replication
 		RecentlySentNotifyTags = FGameplayTagContainer(NotifyTag);
 
-		OnRep_SentNotifyTags();
+		if (ShouldReplicateNotifies())
+		{
+			ReplicateNotify(EFlowNotifyChannel::FromComponent, NotifyTag);
+		}
+
+		BroadcastSentNotifyTags();
 	}
 }
 
@@ -288,15 +422,22 @@ void UFlowComponent::BulkNotifyGraph(const FGameplayTagContainer NotifyTags, con
 		if (ValidatedTags.Num() > 0)
 		{
 			// save recently notify, this allow for the retroactive check in nodes
-			// if retroactive check wouldn't be performed, this is only used by the network replication
 			RecentlySentNotifyTags = ValidatedTags;
 
-			OnRep_SentNotifyTags();
+			if (ShouldReplicateNotifies())
+			{
+				for (const FGameplayTag& ValidatedTag : ValidatedTags)
+				{
+					ReplicateNotify(EFlowNotifyChannel::FromComponent, ValidatedTag);
+				}
+			}
+
+			BroadcastSentNotifyTags();
 		}
 	}
 }
 
-void UFlowComponent::OnRep_SentNotifyTags()
+void UFlowComponent::BroadcastSentNotifyTags()
 {
 	for (const FGameplayTag& NotifyTag : RecentlySentNotifyTags)
 	{
@@ -319,57 +460,41 @@ void UFlowComponent::NotifyFromGraph(const FGameplayTagContainer& NotifyTags, co
 
 		if (ValidatedTags.Num() > 0)
 		{
+			const bool bReplicate = ShouldReplicateNotifies();
+
 			for (const FGameplayTag& ValidatedTag : ValidatedTags)
 			{
 				ReceiveNotify.Broadcast(nullptr, ValidatedTag);
-			}
 
-			if (IsNetMode(NM_DedicatedServer) || IsNetMode(NM_ListenServer))
-			{
-				NotifyTagsFromGraph = ValidatedTags;
+				if (bReplicate)
+				{
+					ReplicateNotify(EFlowNotifyChannel::FromGraph, ValidatedTag);
+				}
 			}
 		}
 	}
 }
 
-void UFlowComponent::OnRep_NotifyTagsFromGraph()
-{
-	for (const FGameplayTag& NotifyTag : NotifyTagsFromGraph)
-	{
-		ReceiveNotify.Broadcast(nullptr, NotifyTag);
-	}
-}
-
 void UFlowComponent::NotifyActor(const FGameplayTag ActorTag, const FGameplayTag NotifyTag, const EFlowNetMode NetMode /* = EFlowNetMode::Authority*/)
 {
 	if (IsFlowNetMode(NetMode) && NotifyTag.IsValid() && HasBegunPlay())
 	{
-		if (const UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
-		{
-			for (const TWeakObjectPtr<UFlowComponent>& Component : FlowSubsystem->GetComponents<UFlowComponent>(ActorTag))
-			{
-				Component->ReceiveNotify.Broadcast(this, NotifyTag);
-			}
-		}
+		BroadcastNotifyToActors(ActorTag, NotifyTag);
 
-		if (IsNetMode(NM_DedicatedServer) || IsNetMode(NM_ListenServer))
+		if (ShouldReplicateNotifies())
 		{
-			NotifyTagsFromAnotherComponent.Empty();
-			NotifyTagsFromAnotherComponent.Add(FNotifyTagReplication(ActorTag, NotifyTag));
+			ReplicateNotify(EFlowNotifyChannel::ToActor, NotifyTag, ActorTag);
 		}
 	}
 }
 
-void UFlowComponent::OnRep_NotifyTagsFromAnotherComponent()
+void UFlowComponent::BroadcastNotifyToActors(const FGameplayTag& ActorTag, const FGameplayTag& NotifyTag)
 {
 	if (const UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
 	{
-		for (const FNotifyTagReplication& Notify : NotifyTagsFromAnotherComponent)
+		for (const TWeakObjectPtr<UFlowComponent>& Component : FlowSubsystem->GetComponents<UFlowComponent>(ActorTag))
 		{
-			for (const TWeakObjectPtr<UFlowComponent>& Component : FlowSubsystem->GetComponents<UFlowComponent>(Notify.ActorTag))
-			{
-				Component->ReceiveNotify.Broadcast(this, Notify.NotifyTag);
-			}
+			Component->ReceiveNotify.Broadcast(this, NotifyTag);
 		}
 	}
 }
@@ -421,6 +546,84 @@ UFlowAsset* UFlowComponent::GetRootFlowInstance() const
 	return nullptr;
 }
 
+void UFlowComponent::MarkRootFlowStateDirty()
+{
+	if (bReplicateRootFlowState && !RootFlowStatesUpdateHandle.IsValid() && GetOwner()->HasAuthority() && GetWorld())
+	{
+		RootFlowStatesUpdateHandle = GetWorld()->GetTimerManager().SetTimerForNextTick(this, &UFlowComponent::UpdateRootFlowStates);
+	}
+}
+
+void UFlowComponent::UpdateRootFlowStates()
+{
+	RootFlowStatesUpdateHandle.Invalidate();
+
+	const TSet<UFlowAsset*> Instances = GetRootInstances(this);
+
+	TSet<FName> InstanceNames;
+	for (const UFlowAsset* Instance : Instances)
+	{
+		InstanceNames.Add(Instance->GetFName());
+	}
+
+	bool bChanged = RootFlowStates.RemoveAll([&InstanceNames](const FFlowRootFlowState& State)
+	{
+		return !InstanceNames.Contains(State.InstanceName);
+	}) > 0;
+
+	for (const UFlowAsset* Instance : Instances)
+	{
+		FFlowRootFlowState* State = RootFlowStates.FindByPredicate([Instance](const FFlowRootFlowState& Existing)
+		{
+			return Existing.InstanceName == Instance->GetFName();
+		});
+
+		if (State == nullptr)
+		{
+			State = &RootFlowStates.AddDefaulted_GetRef();
+			State->TemplateAsset = Instance->GetTemplateAsset();
+			State->InstanceName = Instance->GetFName();
+			bChanged = true;
+		}
+
+		bChanged |= State->Update(*Instance);
+	}
+
+	if (bChanged)
+	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(UFlowComponent, RootFlowStates, this);
+	}
+}
+
+void UFlowComponent::OnRep_RootFlowStates()
+{
+	OnRootFlowStatesReplicated.Broadcast(this);
+
+#if WITH_EDITOR
+	OnRootFlowStatesReplicatedNative.ExecuteIfBound(this);
+#endif
+}
+
+const FFlowRootFlowState* UFlowComponent::FindRootFlowState(const UFlowAsset* TemplateAsset) const
+{
+	return RootFlowStates.FindByPredicate([TemplateAsset](const FFlowRootFlowState& State)
+	{
+		return State.TemplateAsset == TemplateAsset;
+	});
+}
+
+bool UFlowComponent::IsRootFlowNodeActive(const UFlowAsset* TemplateAsset, const FGuid& NodeGuid) const
+{
+	const FFlowRootFlowState* State = FindRootFlowState(TemplateAsset);
+	return State && State->IsNodeActive(NodeGuid);
+}
+
+bool UFlowComponent::IsRootFlowNodeCompleted(const UFlowAsset* TemplateAsset, const FGuid& NodeGuid) const
+{
+	const FFlowRootFlowState* State = FindRootFlowState(TemplateAsset);
+	return State && State->IsNodeCompleted(NodeGuid);
+}
+
 void UFlowComponent::OnTriggerRootFlowOutputEventDispatcher(UFlowAsset* RootFlowInstance, const FName& EventName)
 {
 	BP_OnTriggerRootFlowOutputEvent(RootFlowInstance, EventName);
@@ -0,0 +1,421 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "FlowComponentReplication.h"
+
+#include "FlowAsset.h"
+#include "FlowComponent.h"
+#include "FlowSettings.h"
+#include "FlowSubsystem.h"
+
+#include "Engine/PackageMapClient.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/StructuredArchive.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlowComponentReplication)
+
+bool FFlowIdentityTagList::AddTag(const FGameplayTag& Tag)
+{
+	for (const FFlowIdentityTagItem& Item : Items)
+	{
+		if (Item.Tag == Tag)
+		{
+			return false;
+		}
+	}
+
+	MarkItemDirty(Items.Emplace_GetRef(Tag));
+	return true;
+}
+
+bool FFlowIdentityTagList::RemoveTag(const FGameplayTag& Tag)
+{
+	for (int32 i = 0; i < Items.Num(); i++)
+	{
+		if (Items[i].Tag == Tag)
+		{
+			Items.RemoveAtSwap(i);
+			MarkArrayDirty();
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FFlowIdentityTagList::PreReplicatedRemove(const TArrayView<int32>& RemovedIndices, int32 FinalSize)
+{
+	if (Owner)
+	{
+		FGameplayTagContainer RemovedTags;
+		for (const int32 Index : RemovedIndices)
+		{
+			RemovedTags.AddTag(Items[Index].Tag);
+		}
+
+		Owner->OnReplicatedIdentityTagsRemoved(RemovedTags);
+	}
+}
+
+void FFlowIdentityTagList::PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 FinalSize)
+{
+	if (Owner)
+	{
+		FGameplayTagContainer AddedTags;
+		for (const int32 Index : AddedIndices)
+		{
+			AddedTags.AddTag(Items[Index].Tag);
+		}
+
+		Owner->OnReplicatedIdentityTagsAdded(AddedTags);
+	}
+}
+
+bool FFlowIdentityTagList::NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+{
+	const bool bResult = FFastArraySerializer::FastArrayDeltaSerialize<FFlowIdentityTagItem, FFlowIdentityTagList>(Items, DeltaParms, *this);
+
+	// client might have tags from the actor defaults, which have been removed on server before actor became relevant
+	if (DeltaParms.Reader && !bReceivedInitialState && Owner)
+	{
+		bReceivedInitialState = true;
+
+		FGameplayTagContainer ServerTags;
+		for (const FFlowIdentityTagItem& Item : Items)
+		{
+			ServerTags.AddTag(Item.Tag);
+		}
+
+		FGameplayTagContainer RemovedTags;
+		for (const FGameplayTag& Tag : Owner->IdentityTags)
+		{
+			if (!ServerTags.HasTagExact(Tag))
+			{
+				RemovedTags.AddTag(Tag);
+			}
+		}
+
+		if (RemovedTags.Num() > 0)
+		{
+			Owner->OnReplicatedIdentityTagsRemoved(RemovedTags);
+		}
+	}
+
+	return bResult;
+}
+
+namespace FlowNotifyLog
+{
+	// Limits memory allocated for corrupted or malicious data
+	constexpr uint32 MaxEntriesPerItem = 1024;
+
+	// Set while writing the log for a specific connection
+	thread_local const FFlowNotifyInterest* WriterInterest = nullptr;
+	thread_local double WriterJoinTime = 0.0;
+}
+
+bool FFlowNotifyLogEntry::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint8 ChannelValue = static_cast<uint8>(Channel);
+	Ar.SerializeBits(&ChannelValue, 2);
+	Channel = static_cast<EFlowNotifyChannel>(ChannelValue);
+
+	NotifyTag.NetSerialize(Ar, Map, bOutSuccess);
+
+	if (Channel == EFlowNotifyChannel::ToActor)
+	{
+		ActorTag.NetSerialize(Ar, Map, bOutSuccess);
+	}
+
+	return true;
+}
+
+bool FFlowNotifyLogItem::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	bOutSuccess = true;
+
+	// ids are increasing within the batch, but filtered entries leave gaps, so each id is sent as a delta
+	uint32 PreviousId = 0;
+
+	if (Ar.IsSaving())
+	{
+		TArray<FFlowNotifyLogEntry*, TInlineAllocator<8>> SentEntries;
+
+		// notifies sent before the client joined aren't replayed to it
+		if (CreationTime >= FlowNotifyLog::WriterJoinTime)
+		{
+			for (FFlowNotifyLogEntry& Entry : Entries)
+			{
+				// only notifies sent to Flow Graphs are filtered, other channels are received by arbitrary listeners
+				if (FlowNotifyLog::WriterInterest == nullptr || Entry.Channel != EFlowNotifyChannel::FromComponent
+					|| FlowNotifyLog::WriterInterest->IsInterestedIn(IdentityTags, Entry.NotifyTag))
+				{
+					SentEntries.Add(&Entry);
+				}
+			}
+		}
+
+		uint32 NumEntries = SentEntries.Num();
+		Ar.SerializeIntPacked(NumEntries);
+
+		for (FFlowNotifyLogEntry* Entry : SentEntries)
+		{
+			uint32 IdDelta = Entry->Id - PreviousId;
+			Ar.SerializeIntPacked(IdDelta);
+			PreviousId = Entry->Id;
+
+			Entry->NetSerialize(Ar, Map, bOutSuccess);
+		}
+	}
+	else
+	{
+		uint32 NumEntries = 0;
+		Ar.SerializeIntPacked(NumEntries);
+
+		if (NumEntries > FlowNotifyLog::MaxEntriesPerItem)
+		{
+			Ar.SetError();
+			bOutSuccess = false;
+			return false;
+		}
+
+		Entries.SetNum(NumEntries);
+		for (FFlowNotifyLogEntry& Entry : Entries)
+		{
+			uint32 IdDelta = 0;
+			Ar.SerializeIntPacked(IdDelta);
+			Entry.Id = PreviousId + IdDelta;
+			PreviousId = Entry.Id;
+
+			Entry.NetSerialize(Ar, Map, bOutSuccess);
+		}
+	}
+
+	return true;
+}
+
+bool FFlowNotifyLog::NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+{
+	const FFlowNotifyInterest* Interest = nullptr;
+	double JoinTime = 0.0;
+
+	if (DeltaParms.Writer && Owner)
+	{
+		const UPackageMapClient* PackageMap = Cast<UPackageMapClient>(DeltaParms.Map);
+		const UFlowSubsystem* FlowSubsystem = Owner->GetFlowSubsystem();
+
+		if (PackageMap && FlowSubsystem)
+		{
+			JoinTime = FlowSubsystem->GetConnectionJoinTime(PackageMap->GetConnection());
+
+			if (UFlowSettings::Get()->bFilterNotifiesByClientInterest)
+			{
+				Interest = FlowSubsystem->FindConnectionNotifyInterest(PackageMap->GetConnection());
+			}
+		}
+	}
+
+	TGuardValue<const FFlowNotifyInterest*> InterestGuard(FlowNotifyLog::WriterInterest, Interest);
+	TGuardValue<double> JoinTimeGuard(FlowNotifyLog::WriterJoinTime, JoinTime);
+
+	return FFastArraySerializer::FastArrayDeltaSerialize<FFlowNotifyLogItem, FFlowNotifyLog>(Items, DeltaParms, *this);
+}
+
+void FFlowNotifyLog::AddNotify(const EFlowNotifyChannel Channel, const FGameplayTag& NotifyTag, const FGameplayTag& ActorTag /* = FGameplayTag()*/)
+{
+	const double CurrentTime = FPlatformTime::Seconds();
+	const FGameplayTagContainer& IdentityTags = Owner ? Owner->IdentityTags : FGameplayTagContainer::EmptyContainer;
+
+	// notifies sent during the same frame are replicated as a single item
+	// new item is started if Identity Tags changed, so the client interest is matched against tags the component had while sending the notify
+	if (Items.Num() > 0 && Items.Last().Frame == GFrameCounter && Items.Last().IdentityTags == IdentityTags)
+	{
+		FFlowNotifyLogItem& Batch = Items.Last();
+		Batch.Entries.Emplace(++LastEntryId, Channel, NotifyTag, ActorTag);
+		MarkItemDirty(Batch);
+		return;
+	}
+
+	RemoveExpiredItems(CurrentTime);
+
+	FFlowNotifyLogItem& Batch = Items.AddDefaulted_GetRef();
+	Batch.Frame = GFrameCounter;
+	Batch.CreationTime = CurrentTime;
+	Batch.IdentityTags = IdentityTags;
+	Batch.Entries.Emplace(++LastEntryId, Channel, NotifyTag, ActorTag);
+	MarkItemDirty(Batch);
+}
+
+void FFlowNotifyLog::RemoveExpiredItems(const double CurrentTime)
+{
+	const double RetentionTime = UFlowSettings::Get()->NotifyLogRetentionTime;
+
+	int32 ExpiredItems = 0;
+	while (ExpiredItems < Items.Num() && CurrentTime - Items[ExpiredItems].CreationTime > RetentionTime)
+	{
+		ExpiredItems++;
+	}
+
+	if (ExpiredItems > 0)
+	{
+		Items.RemoveAt(0, ExpiredItems);
+		MarkArrayDirty();
+	}
+}
+
+void FFlowNotifyLog::PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 FinalSize)
+{
+	DispatchPendingEntries();
+}
+
+void FFlowNotifyLog::PostReplicatedChange(const TArrayView<int32>& ChangedIndices, int32 FinalSize)
+{
+	DispatchPendingEntries();
+}
+
+void FFlowNotifyLog::DispatchPendingEntries()
+{
+	if (Owner == nullptr)
+	{
+		return;
+	}
+
+	// items order isn't guaranteed to match the server and the same item can be received again with different entries
+	// entry ids are stable, so every notify is dispatched once and in the order it was sent
+	TArray<FFlowNotifyLogEntry, TInlineAllocator<16>> PendingEntries;
+	for (const FFlowNotifyLogItem& Item : Items)
+	{
+		for (const FFlowNotifyLogEntry& Entry : Item.Entries)
+		{
+			if (Entry.Id > LastDispatchedId)
+			{
+				PendingEntries.Add(Entry);
+			}
+		}
+	}
+
+	if (PendingEntries.Num() == 0)
+	{
+		return;
+	}
+
+	PendingEntries.Sort([](const FFlowNotifyLogEntry& A, const FFlowNotifyLogEntry& B)
+	{
+		return A.Id < B.Id;
+	});
+
+	LastDispatchedId = PendingEntries.Last().Id;
+	Owner->OnNotifiesReplicated(PendingEntries);
+}
+
+namespace FlowRootFlowState
+{
+	void SetBit(TArray<uint32>& NodeBits, const int32 Index)
+	{
+		NodeBits[Index >> 5] |= 1u << (Index & 31);
+	}
+
+	void SerializeSaveGameProperties(FArchive& Ar, const UFlowAsset& Template, UFlowAsset& Instance)
+	{
+		FFlowArchive FlowArchive(Ar);
+		FStructuredArchiveFromArchive StructuredArchive(FlowArchive);
+		FStructuredArchive::FStream Stream = StructuredArchive.GetSlot().EnterStream();
+
+		// template decides which properties are replicated, so order is the same on server and clients
+		for (const FName& PropertyName : Template.GetReplicatedSaveGameProperties())
+		{
+			const FProperty* Property = Instance.GetClass()->FindPropertyByName(PropertyName);
+			if (Property && Property->HasAnyPropertyFlags(CPF_SaveGame))
+			{
+				Property->SerializeItem(Stream.EnterElement(), Property->ContainerPtrToValuePtr<void>(&Instance));
+			}
+		}
+	}
+}
+
+bool FFlowRootFlowState::Update(const UFlowAsset& Instance)
+{
+	const int32 NumWords = FMath::DivideAndRoundUp(Instance.GetNodeIndexSpace().Num(), 32);
+
+	TArray<uint32> NewActiveNodes;
+	TArray<uint32> NewCompletedNodes;
+	NewActiveNodes.SetNumZeroed(NumWords);
+	NewCompletedNodes.SetNumZeroed(NumWords);
+
+	auto AddNode = [&](const UFlowNode* Node)
+	{
+		const int32 Index = Instance.GetNodeIndex(Node->GetGuid());
+		if (Index != INDEX_NONE)
+		{
+			switch (Node->GetActivationState())
+			{
+				case EFlowNodeState::Active:
+					FlowRootFlowState::SetBit(NewActiveNodes, Index);
+					break;
+				case EFlowNodeState::Completed:
+				case EFlowNodeState::Aborted:
+					FlowRootFlowState::SetBit(NewCompletedNodes, Index);
+					break;
+				default:
+					break;
+			}
+		}
+	};
+
+	for (const UFlowNode* Node : Instance.GetActiveNodes())
+	{
+		AddNode(Node);
+	}
+
+	for (const UFlowNode* Node : Instance.GetRecordedNodes())
+	{
+		AddNode(Node);
+	}
+
+	TArray<uint8> NewSaveGameProperties;
+	if (TemplateAsset && TemplateAsset->GetReplicatedSaveGameProperties().Num() > 0)
+	{
+		FMemoryWriter MemoryWriter(NewSaveGameProperties, true);
+		FlowRootFlowState::SerializeSaveGameProperties(MemoryWriter, *TemplateAsset, const_cast<UFlowAsset&>(Instance));
+	}
+
+	if (NewActiveNodes == ActiveNodes && NewCompletedNodes == CompletedNodes && NewSaveGameProperties == SaveGameProperties)
+	{
+		return false;
+	}
+
+	ActiveNodes = MoveTemp(NewActiveNodes);
+	CompletedNodes = MoveTemp(NewCompletedNodes);
+	SaveGameProperties = MoveTemp(NewSaveGameProperties);
+	return true;
+}
+
+bool FFlowRootFlowState::IsNodeActive(const FGuid& NodeGuid) const
+{
+	return IsNodeSet(ActiveNodes, NodeGuid);
+}
+
+bool FFlowRootFlowState::IsNodeCompleted(const FGuid& NodeGuid) const
+{
+	return IsNodeSet(CompletedNodes, NodeGuid);
+}
+
+bool FFlowRootFlowState::IsNodeSet(const TArray<uint32>& NodeBits, const FGuid& NodeGuid) const
+{
+	const int32 Index = TemplateAsset ? TemplateAsset->GetNodeIndex(NodeGuid) : INDEX_NONE;
+	if (Index == INDEX_NONE || (Index >> 5) >= NodeBits.Num())
+	{
+		return false;
+	}
+
+	return (NodeBits[Index >> 5] & (1u << (Index & 31))) != 0;
+}
+
+void FFlowRootFlowState::ApplySaveGameProperties(UFlowAsset& Target) const
+{
+	if (SaveGameProperties.Num() > 0 && ensure(TemplateAsset && Target.IsA(TemplateAsset->GetClass())))
+	{
+		FMemoryReader MemoryReader(SaveGameProperties, true);
+		FlowRootFlowState::SerializeSaveGameProperties(MemoryReader, *TemplateAsset, Target);
+	}
+}
@@ -7,6 +7,8 @@
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowOwnerFunctionParams)
 
 UFlowOwnerFunctionParams::UFlowOwnerFunctionParams()
+	: bImplementsPreExecute(true)
+	, bImplementsPostExecute(true)
 {
 #if WITH_EDITOR
 	InputNames.Add(UFlowNode::DefaultInputPin.PinName);
@@ -14,17 +16,30 @@ UFlowOwnerFunctionParams::UFlowOwnerFunctionParams()
 #endif
 }
 
+void UFlowOwnerFunctionParams::InitializeInstance()
+{
+	const UClass* ParamsClass = GetClass();
+	bImplementsPreExecute = ParamsClass->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UFlowOwnerFunctionParams, BP_PreExecute));
+	bImplementsPostExecute = ParamsClass->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UFlowOwnerFunctionParams, BP_PostExecute));
+}
+
 void UFlowOwnerFunctionParams::PreExecute(UFlowNode_CallOwnerFunction& InSourceNode, const FName& InputPinName)
 {
 	SourceNode = &InSourceNode;
 	ExecutedInputPinName = InputPinName;
 
-	BP_PreExecute();
+	if (bImplementsPreExecute)
+	{
+		BP_PreExecute();
+	}
 }
 
 void UFlowOwnerFunctionParams::PostExecute()
 {
-	BP_PostExecute();
+	if (bImplementsPostExecute)
+	{
+		BP_PostExecute();
+	}
 
 	SourceNode = nullptr;
 	ExecutedInputPinName = NAME_None;
@@ -8,11 +8,29 @@
 
 #include "Logging/LogMacros.h"
 #include "UObject/Class.h"
+#include "UObject/Stack.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowOwnerFunctionRef)
 
+struct FFlowOwnerFunctionRef_Parms
+{
+	// Single FunctionParams object parameter
+	UFlowOwnerFunctionParams* Params;
+
+	// Return value
+	FName OutputPinName;
+};
+
 UFunction* FFlowOwnerFunctionRef::TryResolveFunction(const UClass& InClass)
 {
+	if (IsResolved() && ResolvedClass.Get() == &InClass)
+	{
+		return Function;
+	}
+
+	NativeFunction = nullptr;
+	bInvokeNativeThunk = false;
+
 	if (IsConfigured())
 	{
 		Function = InClass.FindFunctionByName(FunctionName);
@@ -22,6 +40,22 @@ UFunction* FFlowOwnerFunctionRef::TryResolveFunction(const UClass& InClass)
 		Function = nullptr;
 	}
 
+	if (IsResolved())
+	{
+		ResolvedClass = &InClass;
+
+		// typed binding is valid only for the native function, blueprint might override BlueprintNativeEvent
+		if (Function->HasAnyFunctionFlags(FUNC_Native))
+		{
+			NativeFunction = GetNativeFunctions().FindRef(TPair<const UClass*, FName>(Function->GetOuterUClass(), FunctionName));
+			bInvokeNativeThunk = !Function->HasAnyFunctionFlags(FUNC_Net);
+		}
+	}
+	else
+	{
+		ResolvedClass.Reset();
+	}
+
 	return Function;
 }
 
@@ -43,45 +77,111 @@ FName FFlowOwnerFunctionRef::CallFunction(IFlowOwnerInterface& InFlowOwnerInterf
 
 	UObject* FlowOwnerObject = CastChecked<UObject>(&InFlowOwnerInterface);
 
-	struct FFlowOwnerFunctionRef_Parms
+	const FName OutputPinName = InvokeFunction(*FlowOwnerObject, InParams);
+
+	// Ensure the return value is valid
+	if (!OutputPinName.IsNone())
 	{
-		// Single FunctionParams object parameter
-		UFlowOwnerFunctionParams* Params;
+		return ValidateOutputName(OutputPinName, InParams.GatherOutputNames());
+	}
 
-		// Return value
-		FName OutputPinName;
-	};
+	return OutputPinName;
+}
 
-	FFlowOwnerFunctionRef_Parms Parms = {&InParams, NAME_None};
+FName FFlowOwnerFunctionRef::CallFunction(UObject& FlowOwnerObject, UFlowOwnerFunctionParams& InParams, const TSet<FName>& ValidOutputNames) const
+{
+	if (!IsResolved())
+	{
+		UE_LOG(
+			LogFlow,
+			Error,
+			TEXT("Could not resolve function named %s with flow owner class %s"),
+			*FunctionName.ToString(),
+			*FlowOwnerObject.GetClass()->GetName());
+
+		return NAME_None;
+	}
 
-	// Call the owner function itself
-	FlowOwnerObject->ProcessEvent(Function, &Parms);
+	const FName OutputPinName = InvokeFunction(FlowOwnerObject, InParams);
 
 	// Ensure the return value is valid
-	if (!Parms.OutputPinName.IsNone())
+	if (!OutputPinName.IsNone() && !ValidOutputNames.Contains(OutputPinName))
 	{
-		const TArray<FName> OutputNames = InParams.GatherOutputNames();
+		return ValidateOutputName(OutputPinName, ValidOutputNames.Array());
+	}
 
-		if (!OutputNames.Contains(Parms.OutputPinName))
-		{
-			FString OutputNamesStr = TEXT("None");
-			for (const FName& OutputName : OutputNames)
-			{
-				OutputNamesStr += TEXT(", ") + OutputName.ToString();
-			}
-
-			UE_LOG(
-				LogFlow,
-				Error,
-				TEXT("Flow Owner Function %s returned an invalid OutputPinName '%s', which is not in the valid outputs: { %s }"),
-				*FunctionName.ToString(),
-				*Parms.OutputPinName.ToString(),
-				*OutputNamesStr);
-
-			// Replace the invalid output pin name with None
-			Parms.OutputPinName = NAME_None;
-		}
+	return OutputPinName;
+}
+
+void FFlowOwnerFunctionRef::RegisterNativeFunction(const UClass* OwnerClass, const FName& InFunctionName, FFlowOwnerNativeFunction InNativeFunction)
+{
+	check(IsInGameThread());
+
+	if (ensure(OwnerClass && InNativeFunction))
+	{
+		GetNativeFunctions().Add(TPair<const UClass*, FName>(OwnerClass, InFunctionName), InNativeFunction);
+	}
+}
+
+void FFlowOwnerFunctionRef::UnregisterNativeFunction(const UClass* OwnerClass, const FName& InFunctionName)
+{
+	check(IsInGameThread());
+
+	GetNativeFunctions().Remove(TPair<const UClass*, FName>(OwnerClass, InFunctionName));
+}
+
+FName FFlowOwnerFunctionRef::InvokeFunction(UObject& FlowOwnerObject, UFlowOwnerFunctionParams& InParams) const
+{
+	if (NativeFunction)
+	{
+		checkSlow(FlowOwnerObject.IsA(Function->GetOuterUClass()));
+		return NativeFunction(FlowOwnerObject, InParams);
+	}
+
+	FFlowOwnerFunctionRef_Parms Parms = {&InParams, NAME_None};
+
+	if (bInvokeNativeThunk)
+	{
+		// Call the native thunk directly, as ProcessEvent would do for the non-networked native function
+		FFrame Stack(&FlowOwnerObject, Function, &Parms, nullptr, Function->ChildProperties);
+		Function->Invoke(&FlowOwnerObject, Stack, reinterpret_cast<uint8*>(&Parms) + Function->ReturnValueOffset);
+	}
+	else
+	{
+		// Call the owner function itself
+		FlowOwnerObject.ProcessEvent(Function, &Parms);
 	}
 
 	return Parms.OutputPinName;
 }
+
+FName FFlowOwnerFunctionRef::ValidateOutputName(const FName& OutputPinName, const TArray<FName>& OutputNames) const
+{
+	if (OutputNames.Contains(OutputPinName))
+	{
+		return OutputPinName;
+	}
+
+	FString OutputNamesStr = TEXT("None");
+	for (const FName& OutputName : OutputNames)
+	{
+		OutputNamesStr += TEXT(", ") + OutputName.ToString();
+	}
+
+	UE_LOG(
+		LogFlow,
+		Error,
+		TEXT("Flow Owner Function %s returned an invalid OutputPinName '%s', which is not in the valid outputs: { %s }"),
+		*FunctionName.ToString(),
+		*OutputPinName.ToString(),
+		*OutputNamesStr);
+
+	// Replace the invalid output pin name with None
+	return NAME_None;
+}
+
+TMap<TPair<const UClass*, FName>, FFlowOwnerNativeFunction>& FFlowOwnerFunctionRef::GetNativeFunctions()
+{
+	static TMap<TPair<const UClass*, FName>, FFlowOwnerNativeFunction> NativeFunctions;
+	return NativeFunctions;
+}
@@ -8,11 +8,17 @@
 UFlowSettings::UFlowSettings(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, bCreateFlowSubsystemOnClients(true)
+	, NotifyLogRetentionTime(2.0f)
+	, bFilterNotifiesByClientInterest(false)
+	, MaxNotifyInterestTags(256)
 	, bWarnAboutMissingIdentityTags(true)
+	, bEvaluateRootFlowsInParallel(false)
+	, bStripUnreachableNodesOnCook(false)
 	, bLogOnSignalDisabled(true)
 	, bLogOnSignalPassthrough(true)
 	, bUseAdaptiveNodeTitles(false)
 	, DefaultExpectedOwnerClass(UFlowComponent::StaticClass())
+	, MaxPooledLevelSequenceActors(2)
 {
 }
 
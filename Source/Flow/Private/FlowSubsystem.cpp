@@ -7,10 +7,18 @@
 #include "FlowLogChannels.h"
 #include "FlowSave.h"
 #include "FlowSettings.h"
+#include "LevelSequence/FlowLevelSequenceActor.h"
+#include "LevelSequence/FlowLevelSequencePlayer.h"
 #include "Nodes/Route/FlowNode_SubGraph.h"
 
+#include "Async/ParallelFor.h"
 #include "Engine/GameInstance.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/PlayerController.h"
+#include "LevelSequence.h"
 #include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
 #include "Logging/MessageLog.h"
 #include "Misc/Paths.h"
 #include "UObject/UObjectHash.h"
@@ -24,6 +32,22 @@ FNativeFlowAssetEvent UFlowSubsystem::OnInstancedTemplateRemoved;
 
 #define LOCTEXT_NAMESPACE "FlowSubsystem"
 
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice FlowMemReportCommand(
+	TEXT("Flow.MemReport"),
+	TEXT("Lists memory used by Flow Graph instances, per template asset"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+		if (const UFlowSubsystem* FlowSubsystem = GameInstance ? GameInstance->GetSubsystem<UFlowSubsystem>() : nullptr)
+		{
+			FlowSubsystem->DumpMemoryReport(Ar);
+		}
+		else
+		{
+			Ar.Logf(TEXT("Flow.MemReport: no Flow Subsystem in this world"));
+		}
+	}));
+
 UFlowSubsystem::UFlowSubsystem()
 	: LoadedSaveGame(nullptr)
 {
@@ -50,11 +74,18 @@ bool UFlowSubsystem::ShouldCreateSubsystem(UObject* Outer) const
 
 void UFlowSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
+	PostLoginHandle = FGameModeEvents::GameModePostLoginEvent.AddUObject(this, &UFlowSubsystem::OnPostLogin);
 }
 
 void UFlowSubsystem::Deinitialize()
 {
+	FGameModeEvents::GameModePostLoginEvent.Remove(PostLoginHandle);
+	ConnectionJoinTimes.Empty();
+
 	AbortActiveFlows();
+	PendingCommands.Empty();
+	FlowTimers.ClearAllTimers();
+	LevelSequencePool.Empty();
 }
 
 void UFlowSubsystem::AbortActiveFlows()
@@ -184,7 +215,7 @@ UFlowAsset* UFlowSubsystem::CreateSubFlow(UFlowNode_SubGraph* SubGraphNode, cons
 		// get instanced asset from map - in case it was already instanced by calling CreateSubFlow() with bPreloading == true
 		UFlowAsset* AssetInstance = InstancedSubFlows[SubGraphNode];
 
-		AssetInstance->NodeOwningThisAssetInstance = SubGraphNode;
+		AssetInstance->AttachToSubGraph(SubGraphNode);
 		SubGraphNode->GetFlowAsset()->ActiveSubGraphs.Add(SubGraphNode, AssetInstance);
 
 		// don't activate Start Node if we're loading Sub Graph from SaveGame
@@ -202,7 +233,7 @@ void UFlowSubsystem::RemoveSubFlow(UFlowNode_SubGraph* SubGraphNode, const EFlow
 	if (InstancedSubFlows.Contains(SubGraphNode))
 	{
 		UFlowAsset* AssetInstance = InstancedSubFlows[SubGraphNode];
-		AssetInstance->NodeOwningThisAssetInstance = nullptr;
+		AssetInstance->DetachFromSubGraph();
 
 		SubGraphNode->GetFlowAsset()->ActiveSubGraphs.Remove(SubGraphNode);
 		InstancedSubFlows.Remove(SubGraphNode);
@@ -225,7 +256,8 @@ UFlowAsset* UFlowSubsystem::CreateFlowInstance(const TWeakObjectPtr<UObject> Own
 	if (GetWorld()->WorldType != EWorldType::Game)
 	{
 		// Fix connections - even in packaged game if assets haven't been re-saved in the editor after changing node's definition
-		LoadedFlowAsset->HarvestNodeConnections();
+		// Connections are harvested once per template, until graph is modified again
+		LoadedFlowAsset->HarvestNodeConnectionsIfDirty();
 	}
 #endif
 
@@ -305,6 +337,624 @@ UWorld* UFlowSubsystem::GetWorld() const
 	return GetGameInstance()->GetWorld();
 }
 
+void UFlowSubsystem::Tick(float DeltaTime)
+{
+	// signals from other threads are handled before timers, as if they were sent during the previous frame
+	ExecutePendingCommands();
+
+	FlowTimers.Tick(DeltaTime);
+
+	if (bNotifyInterestDirty)
+	{
+		SendNotifyInterest();
+	}
+}
+
+TStatId UFlowSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFlowSubsystem, STATGROUP_Tickables);
+}
+
+ETickableTickType UFlowSubsystem::GetTickableTickType() const
+{
+	// Class Default Object should never tick
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UFlowSubsystem::IsTickable() const
+{
+	// wheel time is only meaningful relative to scheduled timers, so there's no need to advance it while empty
+	return FlowTimers.HasPendingTimers() || bNotifyInterestDirty || !PendingCommands.IsEmpty();
+}
+
+UWorld* UFlowSubsystem::GetTickableGameObjectWorld() const
+{
+	return GetGameInstance() ? GetWorld() : nullptr;
+}
+
+void UFlowSubsystem::EnqueueNotifyGraph(UFlowComponent* Component, const FGameplayTag& NotifyTag, const EFlowNetMode NetMode /* = EFlowNetMode::Authority*/)
+{
+	FFlowSubsystemCommand Command;
+	Command.Type = FFlowSubsystemCommand::EType::NotifyGraph;
+	Command.Target = Component;
+	Command.Tag = NotifyTag;
+	Command.NetMode = NetMode;
+	EnqueueCommand(MoveTemp(Command));
+}
+
+void UFlowSubsystem::EnqueueAddIdentityTag(UFlowComponent* Component, const FGameplayTag& Tag, const EFlowNetMode NetMode /* = EFlowNetMode::Authority*/)
+{
+	FFlowSubsystemCommand Command;
+	Command.Type = FFlowSubsystemCommand::EType::AddIdentityTag;
+	Command.Target = Component;
+	Command.Tag = Tag;
+	Command.NetMode = NetMode;
+	EnqueueCommand(MoveTemp(Command));
+}
+
+void UFlowSubsystem::EnqueueRemoveIdentityTag(UFlowComponent* Component, const FGameplayTag& Tag, const EFlowNetMode NetMode /* = EFlowNetMode::Authority*/)
+{
+	FFlowSubsystemCommand Command;
+	Command.Type = FFlowSubsystemCommand::EType::RemoveIdentityTag;
+	Command.Target = Component;
+	Command.Tag = Tag;
+	Command.NetMode = NetMode;
+	EnqueueCommand(MoveTemp(Command));
+}
+
+void UFlowSubsystem::EnqueueTriggerCustomInput(UFlowAsset* FlowInstance, const FName& EventName)
+{
+	FFlowSubsystemCommand Command;
+	Command.Type = FFlowSubsystemCommand::EType::TriggerCustomInput;
+	Command.Target = FlowInstance;
+	Command.EventName = EventName;
+	EnqueueCommand(MoveTemp(Command));
+}
+
+void UFlowSubsystem::EnqueueStartRootFlow(UObject* Owner, UFlowAsset* FlowAsset, const bool bAllowMultipleInstances /* = true */)
+{
+	FFlowSubsystemCommand Command;
+	Command.Type = FFlowSubsystemCommand::EType::StartRootFlow;
+	Command.Target = Owner;
+	Command.FlowAsset = FlowAsset;
+	Command.bAllowMultipleInstances = bAllowMultipleInstances;
+	EnqueueCommand(MoveTemp(Command));
+}
+
+void UFlowSubsystem::EnqueueCommand(FFlowSubsystemCommand&& Command)
+{
+	PendingCommands.Enqueue(MoveTemp(Command));
+}
+
+void UFlowSubsystem::ExecutePendingCommands()
+{
+	check(IsInGameThread());
+
+	if (!UFlowSettings::Get()->bEvaluateRootFlowsInParallel)
+	{
+		FFlowSubsystemCommand Command;
+		while (PendingCommands.Dequeue(Command))
+		{
+			ExecuteCommand(Command);
+		}
+		return;
+	}
+
+	// only consecutive commands are evaluated in parallel, every serial command flushes them to keep the order of submission
+	TArray<FFlowSubsystemCommand> ParallelCommands;
+
+	FFlowSubsystemCommand Command;
+	while (PendingCommands.Dequeue(Command))
+	{
+		if (CanExecuteInParallel(Command))
+		{
+			ParallelCommands.Add(MoveTemp(Command));
+		}
+		else
+		{
+			ExecuteCommandsInParallel(ParallelCommands);
+			ParallelCommands.Reset();
+
+			ExecuteCommand(Command);
+		}
+	}
+
+	ExecuteCommandsInParallel(ParallelCommands);
+}
+
+void UFlowSubsystem::ExecuteCommand(const FFlowSubsystemCommand& Command)
+{
+	switch (Command.Type)
+	{
+		case FFlowSubsystemCommand::EType::NotifyGraph:
+			if (UFlowComponent* Component = Cast<UFlowComponent>(Command.Target.Get()))
+			{
+				Component->NotifyGraph(Command.Tag, Command.NetMode);
+			}
+			break;
+		case FFlowSubsystemCommand::EType::AddIdentityTag:
+			if (UFlowComponent* Component = Cast<UFlowComponent>(Command.Target.Get()))
+			{
+				Component->AddIdentityTag(Command.Tag, Command.NetMode);
+			}
+			break;
+		case FFlowSubsystemCommand::EType::RemoveIdentityTag:
+			if (UFlowComponent* Component = Cast<UFlowComponent>(Command.Target.Get()))
+			{
+				Component->RemoveIdentityTag(Command.Tag, Command.NetMode);
+			}
+			break;
+		case FFlowSubsystemCommand::EType::TriggerCustomInput:
+			if (UFlowAsset* FlowInstance = Cast<UFlowAsset>(Command.Target.Get()))
+			{
+				FlowInstance->TriggerCustomInput(Command.EventName);
+			}
+			break;
+		case FFlowSubsystemCommand::EType::StartRootFlow:
+			if (Command.Target.IsValid() && Command.FlowAsset.IsValid())
+			{
+				StartRootFlow(Command.Target.Get(), Command.FlowAsset.Get(), Command.bAllowMultipleInstances);
+			}
+			break;
+		default:
+			break;
+	}
+}
+
+namespace FlowParallelEvaluation
+{
+	// Work deferred by the instance evaluated on this thread, set only during the parallel evaluation
+	thread_local TArray<TUniqueFunction<void()>>* DeferredWork = nullptr;
+
+	struct FInstanceBatch
+	{
+		TArray<const FFlowSubsystemCommand*, TInlineAllocator<4>> Commands;
+		TArray<TUniqueFunction<void()>> DeferredWork;
+	};
+}
+
+bool UFlowSubsystem::IsInParallelEvaluation()
+{
+	return FlowParallelEvaluation::DeferredWork != nullptr;
+}
+
+void UFlowSubsystem::RunOnGameThread(TUniqueFunction<void()>&& Work)
+{
+	if (FlowParallelEvaluation::DeferredWork)
+	{
+		FlowParallelEvaluation::DeferredWork->Add(MoveTemp(Work));
+	}
+	else
+	{
+		check(IsInGameThread());
+		Work();
+	}
+}
+
+bool UFlowSubsystem::CanExecuteInParallel(const FFlowSubsystemCommand& Command) const
+{
+	if (Command.Type == FFlowSubsystemCommand::EType::TriggerCustomInput)
+	{
+		UFlowAsset* FlowInstance = Cast<UFlowAsset>(Command.Target.Get());
+		return FlowInstance && RootInstances.Contains(FlowInstance) && FlowInstance->CanEvaluateInParallel();
+	}
+
+	return false;
+}
+
+void UFlowSubsystem::ExecuteCommandsInParallel(TArray<FFlowSubsystemCommand>& Commands)
+{
+	if (Commands.Num() == 0)
+	{
+		return;
+	}
+
+	// commands are grouped per instance, so every instance receives signals in the order of submission
+	TArray<FlowParallelEvaluation::FInstanceBatch> Batches;
+	TMap<const UObject*, int32> BatchIndices;
+
+	for (const FFlowSubsystemCommand& Command : Commands)
+	{
+		const int32* BatchIndex = BatchIndices.Find(Command.Target.Get());
+		FlowParallelEvaluation::FInstanceBatch& Batch = BatchIndex ? Batches[*BatchIndex] : Batches.AddDefaulted_GetRef();
+		if (BatchIndex == nullptr)
+		{
+			BatchIndices.Add(Command.Target.Get(), Batches.Num() - 1);
+		}
+
+		Batch.Commands.Add(&Command);
+	}
+
+	ParallelFor(Batches.Num(), [this, &Batches](const int32 Index)
+	{
+		FlowParallelEvaluation::FInstanceBatch& Batch = Batches[Index];
+		TGuardValue<TArray<TUniqueFunction<void()>>*> DeferredWorkGuard(FlowParallelEvaluation::DeferredWork, &Batch.DeferredWork);
+
+		for (const FFlowSubsystemCommand* Command : Batch.Commands)
+		{
+			ExecuteCommand(*Command);
+		}
+	});
+
+	// world-facing work, in the order of instances and their commands
+	for (FlowParallelEvaluation::FInstanceBatch& Batch : Batches)
+	{
+		for (TUniqueFunction<void()>& Work : Batch.DeferredWork)
+		{
+			Work();
+		}
+	}
+}
+
+bool UFlowSubsystem::ShouldReportNotifyInterest() const
+{
+	return UFlowSettings::Get()->bFilterNotifiesByClientInterest && GetWorld() && GetWorld()->GetNetMode() == NM_Client;
+}
+
+void UFlowSubsystem::AddNotifyInterest(const FGameplayTagContainer& IdentityTags, const FGameplayTagContainer& NotifyTags)
+{
+	if (!ShouldReportNotifyInterest())
+	{
+		return;
+	}
+
+	for (const FGameplayTag& Tag : IdentityTags)
+	{
+		bNotifyInterestDirty |= ++ObservedIdentityTags.FindOrAdd(Tag) == 1;
+	}
+
+	if (!NotifyTags.IsValid())
+	{
+		bNotifyInterestDirty |= ++AnyNotifyTagObservers == 1;
+	}
+
+	for (const FGameplayTag& Tag : NotifyTags)
+	{
+		bNotifyInterestDirty |= ++ObservedNotifyTags.FindOrAdd(Tag) == 1;
+	}
+}
+
+void UFlowSubsystem::RemoveNotifyInterest(const FGameplayTagContainer& IdentityTags, const FGameplayTagContainer& NotifyTags)
+{
+	if (!ShouldReportNotifyInterest())
+	{
+		return;
+	}
+
+	auto RemoveObserver = [this](TMap<FGameplayTag, int32>& ObservedTags, const FGameplayTag& Tag)
+	{
+		if (int32* Count = ObservedTags.Find(Tag))
+		{
+			if (--(*Count) <= 0)
+			{
+				ObservedTags.Remove(Tag);
+				bNotifyInterestDirty = true;
+			}
+		}
+	};
+
+	for (const FGameplayTag& Tag : IdentityTags)
+	{
+		RemoveObserver(ObservedIdentityTags, Tag);
+	}
+
+	if (!NotifyTags.IsValid() && AnyNotifyTagObservers > 0)
+	{
+		bNotifyInterestDirty |= --AnyNotifyTagObservers == 0;
+	}
+
+	for (const FGameplayTag& Tag : NotifyTags)
+	{
+		RemoveObserver(ObservedNotifyTags, Tag);
+	}
+}
+
+void UFlowSubsystem::SendNotifyInterest()
+{
+	UFlowComponent* Sender = NotifyInterestSender.Get();
+	if (Sender == nullptr)
+	{
+		// interest will be sent after registering component owned by the local player
+		bNotifyInterestDirty = false;
+		return;
+	}
+
+	FFlowNotifyInterest Interest;
+	Interest.bAnyNotifyTag = AnyNotifyTagObservers > 0;
+
+	for (const TPair<FGameplayTag, int32>& ObservedTag : ObservedIdentityTags)
+	{
+		Interest.IdentityTags.AddTag(ObservedTag.Key);
+	}
+
+	for (const TPair<FGameplayTag, int32>& ObservedTag : ObservedNotifyTags)
+	{
+		Interest.NotifyTags.AddTag(ObservedTag.Key);
+	}
+
+	Sender->ServerSetNotifyInterest(Interest);
+	bNotifyInterestDirty = false;
+}
+
+void UFlowSubsystem::SetConnectionNotifyInterest(const UNetConnection* Connection, const FFlowNotifyInterest& Interest)
+{
+	if (Connection == nullptr)
+	{
+		return;
+	}
+
+	const FFlowNotifyInterest* CurrentInterest = ConnectionNotifyInterests.Find(Connection);
+	if (CurrentInterest && *CurrentInterest == Interest)
+	{
+		return;
+	}
+
+	// forget closed connections
+	for (auto It = ConnectionNotifyInterests.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	ConnectionNotifyInterests.Add(Connection, Interest);
+}
+
+const FFlowNotifyInterest* UFlowSubsystem::FindConnectionNotifyInterest(const UNetConnection* Connection) const
+{
+	return ConnectionNotifyInterests.Num() > 0 ? ConnectionNotifyInterests.Find(Connection) : nullptr;
+}
+
+void UFlowSubsystem::OnPostLogin(AGameModeBase* GameMode, APlayerController* NewPlayer)
+{
+	// event is global, ignore other game instances in PIE
+	const UNetConnection* Connection = NewPlayer ? NewPlayer->GetNetConnection() : nullptr;
+	if (Connection == nullptr || GameMode->GetGameInstance() != GetGameInstance())
+	{
+		return;
+	}
+
+	// forget closed connections
+	for (auto It = ConnectionJoinTimes.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	ConnectionJoinTimes.Add(Connection, FPlatformTime::Seconds());
+}
+
+double UFlowSubsystem::GetConnectionJoinTime(const UNetConnection* Connection) const
+{
+	return ConnectionJoinTimes.FindRef(Connection);
+}
+
+UFlowLevelSequencePlayer* UFlowSubsystem::AcquireLevelSequencePlayer(ULevelSequence* LevelSequence, const FMovieSceneSequencePlaybackSettings& Settings, const FLevelSequenceCameraSettings& CameraSettings,
+	AActor* TransformOriginActor, const bool bReplicates, const bool bAlwaysRelevant)
+{
+	if (LevelSequence == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (FFlowLevelSequencePool* Pool = LevelSequencePool.Find(LevelSequence))
+	{
+		const UWorld* World = GetWorld();
+
+		for (int32 i = Pool->Actors.Num() - 1; i >= 0; i--)
+		{
+			AFlowLevelSequenceActor* Actor = Pool->Actors[i];
+
+			// actors are destroyed with their world, i.e. after travelling to another map
+			if (!IsValid(Actor) || Actor->GetWorld() != World)
+			{
+				Pool->Actors.RemoveAtSwap(i);
+				continue;
+			}
+
+			if (Actor->CanBeReusedFor(CameraSettings, bReplicates, bAlwaysRelevant))
+			{
+				Pool->Actors.RemoveAtSwap(i);
+
+				Actor->SetActorTransform(UFlowLevelSequencePlayer::GetTransformOriginTransform(TransformOriginActor));
+				UFlowLevelSequencePlayer::ApplyTransformOrigin(Actor, TransformOriginActor);
+				Actor->SetPlaybackSettings(Settings);
+
+				if (UFlowLevelSequencePlayer* Player = Cast<UFlowLevelSequencePlayer>(Actor->GetSequencePlayer()))
+				{
+					return Player;
+				}
+
+				Actor->Destroy();
+			}
+		}
+	}
+
+	ALevelSequenceActor* SpawnedActor;
+	return UFlowLevelSequencePlayer::CreateFlowLevelSequencePlayer(this, LevelSequence, Settings, CameraSettings, TransformOriginActor, bReplicates, bAlwaysRelevant, SpawnedActor);
+}
+
+void UFlowSubsystem::ReleaseLevelSequencePlayer(UFlowLevelSequencePlayer* Player)
+{
+	if (!IsValid(Player))
+	{
+		return;
+	}
+
+	Player->SetFlowEventReceiver(nullptr);
+	Player->Stop();
+
+	AFlowLevelSequenceActor* Actor = Player->GetTypedOuter<AFlowLevelSequenceActor>();
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	const UWorld* World = Actor->GetWorld();
+	if (World == nullptr || World->bIsTearingDown || World != GetWorld())
+	{
+		return;
+	}
+
+	ULevelSequence* LevelSequence = Actor->GetSequence();
+	if (LevelSequence)
+	{
+		FFlowLevelSequencePool& Pool = LevelSequencePool.FindOrAdd(LevelSequence);
+		if (Pool.Actors.Num() < UFlowSettings::Get()->MaxPooledLevelSequenceActors)
+		{
+			Pool.Actors.AddUnique(Actor);
+			return;
+		}
+	}
+
+	Actor->Destroy();
+}
+
+void UFlowSubsystem::PrewarmLevelSequencePlayers(ULevelSequence* LevelSequence, const int32 Count, const FLevelSequenceCameraSettings CameraSettings, const bool bReplicates, const bool bAlwaysRelevant)
+{
+	if (LevelSequence == nullptr || GetWorld() == nullptr)
+	{
+		return;
+	}
+
+	FFlowLevelSequencePool& Pool = LevelSequencePool.FindOrAdd(LevelSequence);
+
+	int32 CompatibleActors = 0;
+	for (const AFlowLevelSequenceActor* Actor : Pool.Actors)
+	{
+		if (IsValid(Actor) && Actor->CanBeReusedFor(CameraSettings, bReplicates, bAlwaysRelevant))
+		{
+			CompatibleActors++;
+		}
+	}
+
+	for (int32 i = CompatibleActors; i < Count; i++)
+	{
+		ALevelSequenceActor* SpawnedActor = nullptr;
+		UFlowLevelSequencePlayer::CreateFlowLevelSequencePlayer(this, LevelSequence, FMovieSceneSequencePlaybackSettings(), CameraSettings, nullptr, bReplicates, bAlwaysRelevant, SpawnedActor);
+
+		if (AFlowLevelSequenceActor* FlowSequenceActor = Cast<AFlowLevelSequenceActor>(SpawnedActor))
+		{
+			Pool.Actors.Add(FlowSequenceActor);
+		}
+	}
+}
+
+void UFlowSubsystem::ClearLevelSequencePool()
+{
+	for (const TPair<TObjectPtr<ULevelSequence>, FFlowLevelSequencePool>& Pool : LevelSequencePool)
+	{
+		for (AFlowLevelSequenceActor* Actor : Pool.Value.Actors)
+		{
+			if (IsValid(Actor))
+			{
+				Actor->Destroy();
+			}
+		}
+	}
+
+	LevelSequencePool.Empty();
+}
+
+void UFlowSubsystem::DumpMemoryReport(FOutputDevice& Ar) const
+{
+	struct FTemplateMemoryStats
+	{
+		const UFlowAsset* Template = nullptr;
+		int32 Instances = 0;
+		int32 NodeObjects = 0;
+		int32 RecordedNodes = 0;
+		SIZE_T TemplateBytes = 0;
+		SIZE_T InstanceBytes = 0;
+		SIZE_T RecordBytes = 0;
+	};
+
+	TArray<FTemplateMemoryStats> TemplateStats;
+	SIZE_T TotalBytes = 0;
+	int32 TotalInstances = 0;
+
+	for (UFlowAsset* Template : InstancedTemplates)
+	{
+		if (!IsValid(Template))
+		{
+			continue;
+		}
+
+		FTemplateMemoryStats& Stats = TemplateStats.AddDefaulted_GetRef();
+		Stats.Template = Template;
+		Stats.TemplateBytes = Template->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+
+		for (UFlowAsset* Instance : Template->ActiveInstances)
+		{
+			if (!IsValid(Instance))
+			{
+				continue;
+			}
+
+			Stats.Instances++;
+			Stats.RecordedNodes += Instance->RecordedNodes.Num();
+			Stats.InstanceBytes += Instance->GetClass()->GetStructureSize() + Instance->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+
+			// instance with nodes created on demand reports only created nodes
+			for (const TPair<FGuid, UFlowNode*>& Node : Instance->Nodes)
+			{
+				if (IsValid(Node.Value))
+				{
+					Stats.NodeObjects++;
+					Stats.InstanceBytes += Node.Value->GetClass()->GetStructureSize() + Node.Value->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+					Stats.RecordBytes += Node.Value->GetPinRecordsAllocatedSize();
+				}
+			}
+		}
+
+		TotalBytes += Stats.TemplateBytes + Stats.InstanceBytes;
+		TotalInstances += Stats.Instances;
+	}
+
+	// most expensive graphs first
+	TemplateStats.Sort([](const FTemplateMemoryStats& A, const FTemplateMemoryStats& B)
+	{
+		return A.TemplateBytes + A.InstanceBytes > B.TemplateBytes + B.InstanceBytes;
+	});
+
+	Ar.Logf(TEXT("Flow memory report: %d templates, %d instances, %.2f KB"), TemplateStats.Num(), TotalInstances, TotalBytes / 1024.0f);
+	Ar.Logf(TEXT("%8s %8s %12s %12s %12s %12s %8s  %s"), TEXT("Inst"), TEXT("Nodes"), TEXT("Template KB"), TEXT("KB/Inst"), TEXT("Total KB"), TEXT("Records KB"), TEXT("Recorded"), TEXT("Template"));
+
+	for (const FTemplateMemoryStats& Stats : TemplateStats)
+	{
+		Ar.Logf(TEXT("%8d %8d %12.2f %12.2f %12.2f %12.2f %8d  %s"),
+			Stats.Instances,
+			Stats.NodeObjects,
+			Stats.TemplateBytes / 1024.0f,
+			Stats.Instances > 0 ? Stats.InstanceBytes / 1024.0f / Stats.Instances : 0.0f,
+			(Stats.TemplateBytes + Stats.InstanceBytes) / 1024.0f,
+			Stats.RecordBytes / 1024.0f,
+			Stats.RecordedNodes,
+			*Stats.Template->GetPathName());
+	}
+
+	// Flow Asset instances aren't pooled, only Level Sequence Actors used by graphs
+	int32 PooledSequenceActors = 0;
+	for (const TPair<TObjectPtr<ULevelSequence>, FFlowLevelSequencePool>& Pool : LevelSequencePool)
+	{
+		PooledSequenceActors += Pool.Value.Actors.Num();
+	}
+
+	int32 LiveSequenceActors = 0;
+	if (const UWorld* World = GetWorld())
+	{
+		for (TActorIterator<AFlowLevelSequenceActor> It(World); It; ++It)
+		{
+			LiveSequenceActors++;
+		}
+	}
+
+	Ar.Logf(TEXT("Level Sequence Actors: %d pooled, %d live"), PooledSequenceActors, LiveSequenceActors - PooledSequenceActors);
+}
+
 void UFlowSubsystem::OnGameSaved(UFlowSaveGame* SaveGame)
 {
 	// clear existing data, in case we received reused SaveGame instance
@@ -420,6 +1070,13 @@ void UFlowSubsystem::LoadSubFlow(UFlowNode_SubGraph* SubGraphNode, const FString
 
 void UFlowSubsystem::RegisterComponent(UFlowComponent* Component)
 {
+	// first component owned by the local player can report tags observed by client-side Flow Graphs
+	if (!NotifyInterestSender.IsValid() && ShouldReportNotifyInterest() && Component->GetOwner()->HasLocalNetOwner())
+	{
+		NotifyInterestSender = Component;
+		bNotifyInterestDirty = true;
+	}
+
 	for (const FGameplayTag& Tag : Component->IdentityTags)
 	{
 		if (Tag.IsValid())
@@ -0,0 +1,301 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "FlowTimerWheel.h"
+
+#include "FlowAsset.h"
+#include "Nodes/FlowNode.h"
+
+FFlowTimerWheel::FFlowTimerWheel()
+	: CurrentTick(0)
+	, AccumulatedTime(0.0)
+	, SerialCounter(0)
+	, InsertionCounter(0)
+{
+}
+
+FFlowTimerHandle FFlowTimerWheel::SetTimer(UFlowNode* Node, const float Rate, const bool bLoop, const float FirstDelay /* = -1.0f */)
+{
+	FFlowTimerHandle Handle;
+	if (Node == nullptr)
+	{
+		return Handle;
+	}
+
+	// zero is reserved for invalid handles
+	if (++SerialCounter == 0)
+	{
+		++SerialCounter;
+	}
+
+	FTimer NewTimer;
+	NewTimer.Node = Node;
+	NewTimer.FlowInstance = Node->GetFlowAsset();
+	NewTimer.ExpireTick = 0;
+	NewTimer.Rate = FMath::Max(0.0f, Rate);
+	NewTimer.ScheduledDilation = 1.0f;
+	NewTimer.PausedRemaining = 0.0f;
+	NewTimer.Serial = SerialCounter;
+	NewTimer.Insertion = 0;
+	NewTimer.bLoop = bLoop;
+	NewTimer.bPaused = false;
+
+	Handle.Index = Timers.Add(NewTimer);
+	Handle.Serial = NewTimer.Serial;
+
+	Schedule(Handle.Index, FirstDelay >= 0.0f ? FirstDelay : NewTimer.Rate, CurrentTick);
+	return Handle;
+}
+
+void FFlowTimerWheel::ClearTimer(FFlowTimerHandle& Handle)
+{
+	if (FindTimer(Handle))
+	{
+		// entries left in the wheel slots are discarded while processing slots
+		Timers.RemoveAt(Handle.Index);
+	}
+
+	Handle.Invalidate();
+}
+
+void FFlowTimerWheel::ClearAllTimers()
+{
+	Timers.Empty();
+
+	for (int32 Level = 0; Level < NumLevels; Level++)
+	{
+		for (int32 Slot = 0; Slot < NumSlots; Slot++)
+		{
+			Wheel[Level][Slot].Empty();
+		}
+	}
+}
+
+bool FFlowTimerWheel::IsTimerActive(const FFlowTimerHandle& Handle) const
+{
+	const FTimer* Timer = FindTimer(Handle);
+	return Timer && !Timer->bPaused;
+}
+
+float FFlowTimerWheel::GetTimerRemaining(const FFlowTimerHandle& Handle) const
+{
+	const FTimer* Timer = FindTimer(Handle);
+	return Timer ? GetRemaining(*Timer) : -1.0f;
+}
+
+float FFlowTimerWheel::GetTimerElapsed(const FFlowTimerHandle& Handle) const
+{
+	if (const FTimer* Timer = FindTimer(Handle))
+	{
+		return FMath::Max(0.0f, Timer->Rate - GetRemaining(*Timer));
+	}
+
+	return -1.0f;
+}
+
+void FFlowTimerWheel::RefreshInstanceTimers(const UFlowAsset* FlowInstance)
+{
+	for (auto It = Timers.CreateIterator(); It; ++It)
+	{
+		// timers of Sub Graph instances inherit time dilation and pause from the parent instance
+		bool bAffected = false;
+		for (const UFlowAsset* Instance = It->FlowInstance.Get(); Instance; Instance = Instance->GetParentInstance())
+		{
+			if (Instance == FlowInstance)
+			{
+				bAffected = true;
+				break;
+			}
+		}
+
+		if (bAffected)
+		{
+			Schedule(It.GetIndex(), GetRemaining(*It), CurrentTick);
+		}
+	}
+}
+
+void FFlowTimerWheel::Tick(const float DeltaTime)
+{
+	AccumulatedTime += DeltaTime;
+	const uint64 TargetTick = static_cast<uint64>(AccumulatedTime / TickResolution);
+
+	if (Timers.Num() == 0)
+	{
+		// nothing to expire, wheel slots can be safely skipped
+		CurrentTick = FMath::Max(CurrentTick, TargetTick);
+		return;
+	}
+
+	ExpiredTimers.Reset();
+
+	while (CurrentTick < TargetTick)
+	{
+		CurrentTick++;
+
+		const int32 SlotIndex = CurrentTick & SlotMask;
+		if (SlotIndex == 0)
+		{
+			// move timers from higher levels down, as lower level has just wrapped around
+			for (int32 Level = 1; Level < NumLevels; Level++)
+			{
+				const int32 LevelSlotIndex = (CurrentTick >> (Level * SlotBits)) & SlotMask;
+				Cascade(Level, LevelSlotIndex);
+
+				if (LevelSlotIndex != 0)
+				{
+					break;
+				}
+			}
+		}
+
+		CollectExpired(Wheel[0][SlotIndex]);
+	}
+
+	// dispatch whole batch after processing the wheel, so callbacks can safely schedule new timers
+	for (int32 i = 0; i < ExpiredTimers.Num(); i++)
+	{
+		const FFlowTimerHandle Handle = ExpiredTimers[i];
+
+		// timer might have been cleared by callback called earlier in this batch
+		if (FindTimer(Handle) == nullptr)
+		{
+			continue;
+		}
+
+		FTimer& Timer = Timers[Handle.Index];
+		UFlowNode* Node = Timer.Node.Get();
+
+		if (Node && Timer.bLoop)
+		{
+			Schedule(Handle.Index, Timer.Rate, Timer.ExpireTick);
+		}
+		else
+		{
+			Timers.RemoveAt(Handle.Index);
+		}
+
+		if (Node)
+		{
+			Node->OnFlowTimer(Handle);
+		}
+	}
+
+	ExpiredTimers.Reset();
+}
+
+const FFlowTimerWheel::FTimer* FFlowTimerWheel::FindTimer(const FFlowTimerHandle& Handle) const
+{
+	if (Handle.IsValid() && Timers.IsValidIndex(Handle.Index) && Timers[Handle.Index].Serial == Handle.Serial)
+	{
+		return &Timers[Handle.Index];
+	}
+
+	return nullptr;
+}
+
+float FFlowTimerWheel::GetRemaining(const FTimer& Timer) const
+{
+	if (Timer.bPaused)
+	{
+		return Timer.PausedRemaining;
+	}
+
+	const double WorldRemaining = FMath::Max(0.0, Timer.ExpireTick * TickResolution - AccumulatedTime);
+	return static_cast<float>(WorldRemaining * Timer.ScheduledDilation);
+}
+
+float FFlowTimerWheel::GetTimeDilation(const FTimer& Timer)
+{
+	const UFlowAsset* FlowInstance = Timer.FlowInstance.Get();
+	return FlowInstance ? FlowInstance->GetTimeDilation() : 1.0f;
+}
+
+bool FFlowTimerWheel::IsInstancePaused(const FTimer& Timer)
+{
+	const UFlowAsset* FlowInstance = Timer.FlowInstance.Get();
+	return FlowInstance && (FlowInstance->AreTimersPaused() || FlowInstance->GetTimeDilation() <= UE_KINDA_SMALL_NUMBER);
+}
+
+void FFlowTimerWheel::Schedule(const int32 Index, const float InstanceDelay, const uint64 BaseTick)
+{
+	FTimer& Timer = Timers[Index];
+
+	if (IsInstancePaused(Timer))
+	{
+		// invalidate entries already placed in the wheel, timer will be placed again after unpausing
+		Timer.Insertion = ++InsertionCounter;
+		Timer.PausedRemaining = FMath::Max(0.0f, InstanceDelay);
+		Timer.bPaused = true;
+		return;
+	}
+
+	Timer.bPaused = false;
+	Timer.PausedRemaining = 0.0f;
+	Timer.ScheduledDilation = GetTimeDilation(Timer);
+
+	const double WorldDelay = FMath::Max(0.0f, InstanceDelay) / Timer.ScheduledDilation;
+	const uint64 DelayTicks = static_cast<uint64>(FMath::CeilToDouble(WorldDelay / TickResolution));
+
+	// timer can't expire earlier than in the next tick, even if it has zero delay
+	Timer.ExpireTick = FMath::Max(BaseTick + DelayTicks, CurrentTick + 1);
+
+	Insert(Index);
+}
+
+void FFlowTimerWheel::Insert(const int32 Index)
+{
+	FTimer& Timer = Timers[Index];
+	Timer.Insertion = ++InsertionCounter;
+
+	uint64 Tick = Timer.ExpireTick;
+	const uint64 Delta = Tick > CurrentTick ? Tick - CurrentTick : 0;
+
+	// timers beyond the range of the wheel are kept in the last slot, and placed again after cascading
+	constexpr uint64 WheelRange = 1ull << (NumLevels * SlotBits);
+	if (Delta >= WheelRange)
+	{
+		Tick = CurrentTick + WheelRange - 1;
+	}
+
+	int32 Level = 0;
+	while (Level < NumLevels - 1 && Delta >= (1ull << ((Level + 1) * SlotBits)))
+	{
+		Level++;
+	}
+
+	const int32 SlotIndex = (Tick >> (Level * SlotBits)) & SlotMask;
+	Wheel[Level][SlotIndex].Add({Index, Timer.Insertion});
+}
+
+void FFlowTimerWheel::Cascade(const int32 Level, const int32 SlotIndex)
+{
+	TArray<FSlotEntry> Entries = MoveTemp(Wheel[Level][SlotIndex]);
+	Wheel[Level][SlotIndex].Reset();
+
+	for (const FSlotEntry& Entry : Entries)
+	{
+		if (Timers.IsValidIndex(Entry.Index) && Timers[Entry.Index].Insertion == Entry.Insertion)
+		{
+			Insert(Entry.Index);
+		}
+	}
+}
+
+void FFlowTimerWheel::CollectExpired(TArray<FSlotEntry>& Slot)
+{
+	for (const FSlotEntry& Entry : Slot)
+	{
+		if (Timers.IsValidIndex(Entry.Index) && Timers[Entry.Index].Insertion == Entry.Insertion)
+		{
+			FFlowTimerHandle Handle;
+			Handle.Index = Entry.Index;
+			Handle.Serial = Timers[Entry.Index].Serial;
+			ExpiredTimers.Add(Handle);
+
+			// entry is consumed, looping timers get a new one once rescheduled
+			Timers[Entry.Index].Insertion = ++InsertionCounter;
+		}
+	}
+
+	Slot.Reset();
+}
@@ -34,6 +34,14 @@ void AFlowLevelSequenceActor::SetReplicatedLevelSequenceAsset(ULevelSequence* As
 	}
 }
 
+bool AFlowLevelSequenceActor::CanBeReusedFor(const FLevelSequenceCameraSettings& InCameraSettings, const bool bInReplicates, const bool bInAlwaysRelevant) const
+{
+	return bReplicatePlayback == bInReplicates
+		&& (!bInReplicates || bAlwaysRelevant == bInAlwaysRelevant)
+		&& CameraSettings.bOverrideAspectRatioAxisConstraint == InCameraSettings.bOverrideAspectRatioAxisConstraint
+		&& CameraSettings.AspectRatioAxisConstraint == InCameraSettings.AspectRatioAxisConstraint;
+}
+
 void AFlowLevelSequenceActor::OnRep_ReplicatedLevelSequenceAsset()
 {
 	LevelSequenceAsset = ReplicatedLevelSequenceAsset;
@@ -2,7 +2,7 @@
 
 #include "LevelSequence/FlowLevelSequencePlayer.h"
 #include "LevelSequence/FlowLevelSequenceActor.h"
-#include "Nodes/FlowNode.h"
+#include "Nodes/World/FlowNode_PlayLevelSequence.h"
 
 #include "DefaultLevelSequenceInstanceData.h"
 #include "Runtime/Launch/Resources/Version.h"
@@ -12,6 +12,7 @@
 UFlowLevelSequencePlayer::UFlowLevelSequencePlayer(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, FlowEventReceiver(nullptr)
+	, PlayLevelSequenceNode(nullptr)
 {
 }
 
@@ -38,21 +39,7 @@ UFlowLevelSequencePlayer* UFlowLevelSequencePlayer::CreateFlowLevelSequencePlaye
 	}
 
 	// Sequence Actor might be spawned exactly where playback happens
-	FTransform SpawnTransform = FTransform::Identity;
-	{
-		// apply Transform Origin
-		// https://docs.unrealengine.com/5.0/en-US/creating-level-sequences-with-dynamic-transforms-in-unreal-engine/
-#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION > 3
-		if (TransformOriginActor->IsValidLowLevel())
-#else
-		if (IsValid(TransformOriginActor))
-#endif
-		{
-			// moving Level Sequence Actor might allow proper distance-based actor replication in networked games
-			SpawnTransform = TransformOriginActor->GetTransform();
-			SpawnTransform = FTransform(SpawnTransform.GetRotation(), SpawnTransform.GetLocation(), FVector::OneVector);
-		}
-	}
+	const FTransform SpawnTransform = GetTransformOriginTransform(TransformOriginActor);
 
 	// Create Sequence Actor
 	// We use deferred spawn, so we can set all actor properties prior to its initialization.
@@ -62,18 +49,7 @@ UFlowLevelSequencePlayer* UFlowLevelSequencePlayer::CreateFlowLevelSequencePlaye
 	Actor->CameraSettings = CameraSettings;
 
 	// apply Transform Origin to spawned actor
-#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION > 3
-	if (TransformOriginActor->IsValidLowLevel())
-#else
-	if (IsValid(TransformOriginActor))
-#endif
-	{
-		if (UDefaultLevelSequenceInstanceData* InstanceData = Cast<UDefaultLevelSequenceInstanceData>(Actor->DefaultInstanceData))
-		{
-			Actor->bOverrideInstanceData = true;
-			InstanceData->TransformOriginActor = TransformOriginActor;
-		}
-	}
+	ApplyTransformOrigin(Actor, TransformOriginActor);
 
 	// support networking
 	if (bReplicates)
@@ -95,6 +71,48 @@ UFlowLevelSequencePlayer* UFlowLevelSequencePlayer::CreateFlowLevelSequencePlaye
 	return Cast<UFlowLevelSequencePlayer>(Actor->GetSequencePlayer());
 }
 
+void UFlowLevelSequencePlayer::SetFlowEventReceiver(UFlowNode* FlowNode)
+{
+	FlowEventReceiver = FlowNode;
+	PlayLevelSequenceNode = Cast<UFlowNode_PlayLevelSequence>(FlowNode);
+}
+
+FTransform UFlowLevelSequencePlayer::GetTransformOriginTransform(AActor* TransformOriginActor)
+{
+	// apply Transform Origin
+	// https://docs.unrealengine.com/5.0/en-US/creating-level-sequences-with-dynamic-transforms-in-unreal-engine/
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION > 3
+	if (TransformOriginActor->IsValidLowLevel())
+#else
+	if (IsValid(TransformOriginActor))
+#endif
+	{
+		// moving Level Sequence Actor might allow proper distance-based actor replication in networked games
+		const FTransform OriginTransform = TransformOriginActor->GetTransform();
+		return FTransform(OriginTransform.GetRotation(), OriginTransform.GetLocation(), FVector::OneVector);
+	}
+
+	return FTransform::Identity;
+}
+
+void UFlowLevelSequencePlayer::ApplyTransformOrigin(AFlowLevelSequenceActor* Actor, AActor* TransformOriginActor)
+{
+	if (UDefaultLevelSequenceInstanceData* InstanceData = Cast<UDefaultLevelSequenceInstanceData>(Actor->DefaultInstanceData))
+	{
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION > 3
+		const bool bHasTransformOrigin = TransformOriginActor->IsValidLowLevel();
+#else
+		const bool bHasTransformOrigin = IsValid(TransformOriginActor);
+#endif
+		// pooled actor might have been used with a different Transform Origin before
+		if (bHasTransformOrigin || Actor->bOverrideInstanceData)
+		{
+			Actor->bOverrideInstanceData = bHasTransformOrigin;
+			InstanceData->TransformOriginActor = bHasTransformOrigin ? TransformOriginActor : nullptr;
+		}
+	}
+}
+
 TArray<UObject*> UFlowLevelSequencePlayer::GetEventContexts() const
 {
 	TArray<UObject*> EventContexts;
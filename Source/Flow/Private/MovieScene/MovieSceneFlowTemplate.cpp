@@ -2,8 +2,10 @@
 
 #include "MovieScene/MovieSceneFlowTemplate.h"
 #include "MovieScene/MovieSceneFlowTrack.h"
+#include "LevelSequence/FlowLevelSequencePlayer.h"
 #include "Nodes/World/FlowNode_PlayLevelSequence.h"
 
+#include "Algo/BinarySearch.h"
 #include "Evaluation/MovieSceneEvaluation.h"
 #include "IMovieScenePlayer.h"
 
@@ -15,22 +17,35 @@ DECLARE_CYCLE_STAT(TEXT("Flow Track Token Execute"), MovieSceneEval_FlowTrack_To
 
 struct FFlowTrackExecutionToken final : IMovieSceneExecutionToken
 {
-	FFlowTrackExecutionToken(TArray<FString> InEventNames)
+	FFlowTrackExecutionToken(TArray<FName> InEventNames)
 		: EventNames(MoveTemp(InEventNames))
 	{
 	}
 
-	TArray<FString> EventNames;
+	TArray<FName> EventNames;
 
 	virtual void Execute(const FMovieSceneContext& Context, const FMovieSceneEvaluationOperand& Operand, FPersistentEvaluationData& PersistentData, IMovieScenePlayer& Player) override
 	{
 		MOVIESCENE_DETAILED_SCOPE_CYCLE_COUNTER(MovieSceneEval_FlowTrack_TokenExecute)
 
-		for (const FString& EventName : EventNames)
+		// Flow player knows its receiver, no need to gather and cast event contexts
+		if (const UFlowLevelSequencePlayer* FlowPlayer = Cast<UFlowLevelSequencePlayer>(Player.AsUObject()))
 		{
-			for (UObject* EventReceiver : Player.GetEventContexts())
+			if (UFlowNode_PlayLevelSequence* FlowNode = FlowPlayer->GetPlayLevelSequenceNode())
 			{
-				if (UFlowNode_PlayLevelSequence* FlowNode = Cast<UFlowNode_PlayLevelSequence>(EventReceiver))
+				for (const FName& EventName : EventNames)
+				{
+					FlowNode->TriggerEvent(EventName);
+				}
+			}
+			return;
+		}
+
+		for (UObject* EventReceiver : Player.GetEventContexts())
+		{
+			if (UFlowNode_PlayLevelSequence* FlowNode = Cast<UFlowNode_PlayLevelSequence>(EventReceiver))
+			{
+				for (const FName& EventName : EventNames)
 				{
 					FlowNode->TriggerEvent(EventName);
 				}
@@ -49,10 +64,14 @@ FMovieSceneFlowTriggerTemplate::FMovieSceneFlowTriggerTemplate(const UMovieScene
 	EventTimes.Reserve(Times.Num());
 	EventNames.Reserve(Times.Num());
 
+	// channel keeps keys sorted by time, keys without event are dropped here, so evaluation doesn't have to skip them
 	for (int32 Index = 0; Index < Times.Num(); ++Index)
 	{
-		EventTimes.Add(Times[Index]);
-		EventNames.Add(EntryPoints[Index]);
+		if (!EntryPoints[Index].IsEmpty())
+		{
+			EventTimes.Add(Times[Index]);
+			EventNames.Add(FName(*EntryPoints[Index]));
+		}
 	}
 }
 
@@ -73,42 +92,49 @@ void FMovieSceneFlowTriggerTemplate::EvaluateSwept(const FMovieSceneEvaluationOp
 		return;
 	}
 
-	TArray<FString> EventsToTrigger;
+	// find keys inside swept range with binary search, so cost doesn't grow with the number of keys in the section
+	const TRangeBound<FFrameNumber>& LowerBound = SweptRange.GetLowerBound();
+	const TRangeBound<FFrameNumber>& UpperBound = SweptRange.GetUpperBound();
+
+	const int32 FirstKey = LowerBound.IsOpen() ? 0
+		: LowerBound.IsInclusive() ? Algo::LowerBound(EventTimes, LowerBound.GetValue())
+		: Algo::UpperBound(EventTimes, LowerBound.GetValue());
+
+	const int32 LastKey = UpperBound.IsOpen() ? EventTimes.Num()
+		: UpperBound.IsInclusive() ? Algo::UpperBound(EventTimes, UpperBound.GetValue())
+		: Algo::LowerBound(EventTimes, UpperBound.GetValue());
+
+	if (FirstKey >= LastKey)
+	{
+		return;
+	}
+
+	TArray<FName> EventsToTrigger;
+	EventsToTrigger.Reserve(LastKey - FirstKey);
 
 	if (bBackwards)
 	{
 		// Trigger events backwards
-		for (int32 KeyIndex = EventTimes.Num() - 1; KeyIndex >= 0; --KeyIndex)
+		for (int32 KeyIndex = LastKey - 1; KeyIndex >= FirstKey; --KeyIndex)
 		{
-			FFrameNumber Time = EventTimes[KeyIndex];
-			if (!EventNames[KeyIndex].IsEmpty() && SweptRange.Contains(Time))
-			{
-				EventsToTrigger.Add(EventNames[KeyIndex]);
-			}
+			EventsToTrigger.Add(EventNames[KeyIndex]);
 		}
 	}
 	else
 	{
 		// Trigger events forwards
-		for (int32 KeyIndex = 0; KeyIndex < EventTimes.Num(); ++KeyIndex)
+		for (int32 KeyIndex = FirstKey; KeyIndex < LastKey; ++KeyIndex)
 		{
-			FFrameNumber Time = EventTimes[KeyIndex];
-			if (!EventNames[KeyIndex].IsEmpty() && SweptRange.Contains(Time))
-			{
-				EventsToTrigger.Add(EventNames[KeyIndex]);
-			}
+			EventsToTrigger.Add(EventNames[KeyIndex]);
 		}
 	}
 
-	if (EventsToTrigger.Num())
-	{
-		ExecutionTokens.Add(FFlowTrackExecutionToken(MoveTemp(EventsToTrigger)));
-	}
+	ExecutionTokens.Add(FFlowTrackExecutionToken(MoveTemp(EventsToTrigger)));
 }
 
 FMovieSceneFlowRepeaterTemplate::FMovieSceneFlowRepeaterTemplate(const UMovieSceneFlowRepeaterSection& Section, const UMovieSceneFlowTrack& Track)
 	: FMovieSceneFlowTemplateBase(Track, Section)
-	, EventName(Section.EventName)
+	, EventName(Section.EventName.IsEmpty() ? NAME_None : FName(*Section.EventName))
 {
 }
 
@@ -120,7 +146,7 @@ void FMovieSceneFlowRepeaterTemplate::EvaluateSwept(const FMovieSceneEvaluationO
 	// Don't allow events to fire when playback is in a stopped state. This can occur when stopping 
 	// playback and returning the current position to the start of playback. It's not desirable to have 
 	// all the events from the last playback position to the start of playback be fired.
-	if (EventName.IsEmpty() || !SweptRange.Contains(CurrentFrame) || Context.GetStatus() == EMovieScenePlayerStatus::Stopped || Context.IsSilent())
+	if (EventName.IsNone() || !SweptRange.Contains(CurrentFrame) || Context.GetStatus() == EMovieScenePlayerStatus::Stopped || Context.IsSilent())
 	{
 		return;
 	}
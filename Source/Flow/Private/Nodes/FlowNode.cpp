@@ -8,20 +8,21 @@
 #include "FlowSettings.h"
 #include "FlowSubsystem.h"
 #include "FlowTypes.h"
+#include "Nodes/FlowNodeBlueprint.h"
 
+#include "Algo/BinarySearch.h"
 #include "Components/ActorComponent.h"
 #include "Engine/Blueprint.h"
 #include "Engine/Engine.h"
 #include "Engine/ViewportStatsSubsystem.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
-#include "Misc/App.h"
 #include "Misc/Paths.h"
 #include "Serialization/MemoryReader.h"
 #include "Serialization/MemoryWriter.h"
 
-#if WITH_EDITOR
-#include "Editor.h"
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION > 3
+#include "UObject/AssetRegistryTagsContext.h"
 #endif
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNode)
@@ -44,6 +45,7 @@ UFlowNode::UFlowNode(const FObjectInitializer& ObjectInitializer)
 #endif
 	, AllowedSignalModes({EFlowSignalMode::Enabled, EFlowSignalMode::Disabled, EFlowSignalMode::PassThrough})
 	, SignalMode(EFlowSignalMode::Enabled)
+	, ThreadSafeClass(nullptr)
 	, bPreloaded(false)
 	, ActivationState(EFlowNodeState::NeverActivated)
 {
@@ -68,6 +70,8 @@ void UFlowNode::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEve
 	{
 		OnReconstructionRequested.ExecuteIfBound();
 	}
+
+	OnPropertyEdited.ExecuteIfBound();
 }
 
 void UFlowNode::PostLoad()
@@ -78,6 +82,68 @@ void UFlowNode::PostLoad()
 	FixNode(nullptr);
 }
 
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION > 3
+void UFlowNode::GetAssetRegistryTags(FAssetRegistryTagsContext Context) const
+{
+	Super::GetAssetRegistryTags(Context);
+
+	GetBlueprintNodeTags([&Context](const FName& Name, const FString& Value)
+	{
+		Context.AddTag(FAssetRegistryTag(Name, Value, FAssetRegistryTag::TT_Hidden));
+	});
+}
+#else
+void UFlowNode::GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const
+{
+	Super::GetAssetRegistryTags(OutTags);
+
+	GetBlueprintNodeTags([&OutTags](const FName& Name, const FString& Value)
+	{
+		OutTags.Emplace(Name, Value, FAssetRegistryTag::TT_Hidden);
+	});
+}
+#endif
+
+void UFlowNode::GetBlueprintNodeTags(TFunctionRef<void(const FName&, const FString&)> AddTag) const
+{
+	if (!HasAnyFlags(RF_ClassDefaultObject) || GetClass()->ClassGeneratedBy == nullptr)
+	{
+		return;
+	}
+
+	auto JoinClassPaths = [](const TArray<TSubclassOf<UFlowAsset>>& Classes)
+	{
+		TArray<FString> ClassPaths;
+		for (const UClass* Class : Classes)
+		{
+			if (Class)
+			{
+				ClassPaths.Emplace(Class->GetPathName());
+			}
+		}
+		return FString::Join(ClassPaths, TEXT(","));
+	};
+
+	// same rule as UFlowGraphSchema::IsFlowNodePlaceable
+	const bool bPlaceable = !GetClass()->HasAnyClassFlags(CLASS_Abstract | CLASS_NotPlaceable | CLASS_Deprecated) && !bNodeDeprecated;
+	AddTag(FFlowNodeBlueprintTags::PlaceableTag, bPlaceable ? TEXT("True") : TEXT("False"));
+
+	AddTag(FFlowNodeBlueprintTags::CategoryTag, GetNodeCategory());
+	AddTag(FFlowNodeBlueprintTags::TitleTag, GetNodeTitle().ToString());
+	AddTag(FFlowNodeBlueprintTags::ToolTipTag, GetNodeToolTip().ToString());
+	AddTag(FFlowNodeBlueprintTags::KeywordsTag, GetClass()->GetMetaData(TEXT("Keywords")));
+
+	TArray<FString> ClassHierarchy;
+	for (const UClass* Class = GetClass(); Class && Class != UFlowNode::StaticClass()->GetSuperClass(); Class = Class->GetSuperClass())
+	{
+		ClassHierarchy.Emplace(Class->GetPathName());
+	}
+	AddTag(FFlowNodeBlueprintTags::ClassHierarchyTag, FString::Join(ClassHierarchy, TEXT(",")));
+
+	AddTag(FFlowNodeBlueprintTags::AllowedAssetClassesTag, JoinClassPaths(AllowedAssetClasses));
+	AddTag(FFlowNodeBlueprintTags::DeniedAssetClassesTag, JoinClassPaths(DeniedAssetClasses));
+}
+
 void UFlowNode::FixNode(UEdGraphNode* NewGraphNode)
 {
 	// Fix any node pointers that may be out of date
@@ -426,13 +492,31 @@ void UFlowNode::RemoveUserOutput(const FName& PinName)
 TSet<UFlowNode*> UFlowNode::GetConnectedNodes() const
 {
 	TSet<UFlowNode*> Result;
-	for (const TPair<FName, FConnectedPin>& Connection : Connections)
+
+	if (const UFlowAsset* FlowAsset = GetFlowAsset())
 	{
-		Result.Emplace(GetFlowAsset()->GetNode(Connection.Value.NodeGuid));
+		const TConstArrayView<int32> NodeIndices = GetConnectedNodeIndices();
+		Result.Reserve(NodeIndices.Num());
+
+		for (const int32 NodeIndex : NodeIndices)
+		{
+			Result.Emplace(FlowAsset->GetNodeByIndex(NodeIndex));
+		}
 	}
+
 	return Result;
 }
 
+TConstArrayView<int32> UFlowNode::GetConnectedNodeIndices() const
+{
+	if (const UFlowAsset* FlowAsset = GetFlowAsset())
+	{
+		return FlowAsset->GetGraphTopology().GetConnectedNodes(FlowAsset->GetNodeIndex(NodeGuid));
+	}
+
+	return TConstArrayView<int32>();
+}
+
 FName UFlowNode::GetPinConnectedToNode(const FGuid& OtherNodeGuid)
 {
 	for (const TPair<FName, FConnectedPin>& Connection : Connections)
@@ -448,21 +532,10 @@ FName UFlowNode::GetPinConnectedToNode(const FGuid& OtherNodeGuid)
 
 bool UFlowNode::IsInputConnected(const FName& PinName) const
 {
-	if (GetFlowAsset())
+	if (const UFlowAsset* FlowAsset = GetFlowAsset())
 	{
-		for (const TPair<FGuid, UFlowNode*>& Pair : GetFlowAsset()->Nodes)
-		{
-			if (Pair.Value)
-			{
-				for (const TPair<FName, FConnectedPin>& Connection : Pair.Value->Connections)
-				{
-					if (Connection.Value.NodeGuid == NodeGuid && Connection.Value.PinName == PinName)
-					{
-						return true;
-					}
-				}
-			}
-		}
+		// topology is shared with template, so it doesn't depend on nodes created by instance
+		return FlowAsset->GetGraphTopology().GetConnectedInputs(FlowAsset->GetNodeIndex(NodeGuid)).Contains(PinName);
 	}
 
 	return false;
@@ -475,23 +548,41 @@ bool UFlowNode::IsOutputConnected(const FName& PinName) const
 
 void UFlowNode::RecursiveFindNodesByClass(UFlowNode* Node, const TSubclassOf<UFlowNode> Class, uint8 Depth, TArray<UFlowNode*>& OutNodes)
 {
-	if (Node)
+	// query doesn't call back into user code, so a single scratch per thread is enough
+	static thread_local FFlowGraphTraversalScratch Scratch;
+	RecursiveFindNodesByClass(Node, Class, Depth, OutNodes, Scratch);
+}
+
+void UFlowNode::RecursiveFindNodesByClass(UFlowNode* Node, const TSubclassOf<UFlowNode> Class, uint8 Depth, TArray<UFlowNode*>& OutNodes, FFlowGraphTraversalScratch& Scratch)
+{
+	if (Node && OutNodes.Num() != Depth)
 	{
-		// Record the node if it is the desired type
-		if (Node->GetClass() == Class)
-		{
-			OutNodes.AddUnique(Node);
-		}
+		const UFlowAsset* FlowAsset = Node->GetFlowAsset();
+		const FFlowGraphTopology& Topology = FlowAsset->GetGraphTopology();
 
-		if (OutNodes.Num() == Depth)
+		// indices of nodes of this class are sorted
+		const TConstArrayView<int32> NodesOfClass = Topology.GetNodesOfClass(Class);
+		if (NodesOfClass.Num() == 0)
 		{
 			return;
 		}
 
-		// Recurse
-		for (UFlowNode* ConnectedNode : Node->GetConnectedNodes())
+		// depth-first order, same as recursion over connected nodes
+		TArray<int32>& NodeIndices = Scratch.NodeIndices;
+		NodeIndices.Reset();
+		Topology.GatherExecutionOrder(FlowAsset->GetNodeIndex(Node->GetGuid()), NodeIndices, Scratch);
+
+		for (const int32 NodeIndex : NodeIndices)
 		{
-			RecursiveFindNodesByClass(ConnectedNode, Class, Depth, OutNodes);
+			if (Algo::BinarySearch(NodesOfClass, NodeIndex) != INDEX_NONE)
+			{
+				OutNodes.AddUnique(FlowAsset->GetNodeByIndex(NodeIndex));
+
+				if (OutNodes.Num() == Depth)
+				{
+					return;
+				}
+			}
 		}
 	}
 }
@@ -540,7 +631,11 @@ void UFlowNode::FlushContent()
 
 void UFlowNode::OnActivate()
 {
-	K2_OnActivate();
+	// thread-safe nodes are native classes, so they have no blueprint implementation to call from worker threads
+	if (IsInGameThread())
+	{
+		K2_OnActivate();
+	}
 }
 
 void UFlowNode::TriggerInput(const FName& PinName, const EFlowPinActivationType ActivationType /*= Default*/)
@@ -550,7 +645,8 @@ void UFlowNode::TriggerInput(const FName& PinName, const EFlowPinActivationType
 		// entirely ignore any Input activation
 	}
 
-	if (InputPins.Contains(PinName))
+	const int32 PinIndex = InputPins.IndexOfByKey(PinName);
+	if (PinIndex != INDEX_NONE)
 	{
 		if (SignalMode == EFlowSignalMode::Enabled)
 		{
@@ -564,22 +660,16 @@ void UFlowNode::TriggerInput(const FName& PinName, const EFlowPinActivationType
 		}
 
 #if !UE_BUILD_SHIPPING
-		// record for debugging
-		TArray<FPinRecord>& Records = InputRecords.FindOrAdd(PinName);
-		Records.Add(FPinRecord(FApp::GetCurrentTime(), ActivationType));
-#endif // UE_BUILD_SHIPPING
-
-#if WITH_EDITOR
-		if (GEditor && UFlowAsset::GetFlowGraphInterface().IsValid())
+		if (IFlowInstanceObserver* Observer = GetFlowAsset()->GetInstanceObserver())
 		{
-			UFlowAsset::GetFlowGraphInterface()->OnInputTriggered(GraphNode, InputPins.IndexOfByKey(PinName));
+			Observer->OnInputTriggered(*this, PinIndex, ActivationType);
 		}
-#endif // WITH_EDITOR
+#endif // UE_BUILD_SHIPPING
 	}
 	else
 	{
 #if !UE_BUILD_SHIPPING
-		LogError(FString::Printf(TEXT("Input Pin name %s invalid"), *PinName.ToString()));
+		LogInvalidPin(TEXT("Input Pin name"), PinName.ToString());
 #endif // UE_BUILD_SHIPPING
 		return;
 	}
@@ -587,7 +677,7 @@ void UFlowNode::TriggerInput(const FName& PinName, const EFlowPinActivationType
 	switch (SignalMode)
 	{
 		case EFlowSignalMode::Enabled:
-			ExecuteInput(PinName);
+			ExecuteInputByIndex(PinIndex);
 			break;
 		case EFlowSignalMode::Disabled:
 			if (UFlowSettings::Get()->bLogOnSignalDisabled)
@@ -608,18 +698,46 @@ void UFlowNode::TriggerInput(const FName& PinName, const EFlowPinActivationType
 
 void UFlowNode::ExecuteInput(const FName& PinName)
 {
-	K2_ExecuteInput(PinName);
+	if (IsInGameThread())
+	{
+		K2_ExecuteInput(PinName);
+	}
+}
+
+void UFlowNode::ExecuteInputByIndex(const int32 PinIndex)
+{
+	ExecuteInput(InputPins[PinIndex].PinName);
 }
 
 void UFlowNode::TriggerFirstOutput(const bool bFinish)
 {
 	if (OutputPins.Num() > 0)
 	{
-		TriggerOutput(OutputPins[0].PinName, bFinish);
+		TriggerOutputByIndex(0, bFinish);
 	}
 }
 
 void UFlowNode::TriggerOutput(const FName& PinName, const bool bFinish /*= false*/, const EFlowPinActivationType ActivationType /*= Default*/)
+{
+	const int32 PinIndex = OutputPins.IndexOfByKey(PinName);
+	if (PinIndex == INDEX_NONE)
+	{
+		// clean up node, if needed
+		if (bFinish)
+		{
+			Finish();
+		}
+
+#if !UE_BUILD_SHIPPING
+		LogInvalidPin(TEXT("Output Pin name"), PinName.ToString());
+#endif // UE_BUILD_SHIPPING
+		return;
+	}
+
+	TriggerOutputByIndex(PinIndex, bFinish, ActivationType);
+}
+
+void UFlowNode::TriggerOutputByIndex(const int32 PinIndex, const bool bFinish /*= false*/, const EFlowPinActivationType ActivationType /*= Default*/)
 {
 	// clean up node, if needed
 	if (bFinish)
@@ -627,31 +745,27 @@ void UFlowNode::TriggerOutput(const FName& PinName, const bool bFinish /*= false
 		Finish();
 	}
 
-#if !UE_BUILD_SHIPPING
-	if (OutputPins.Contains(PinName))
+	if (!OutputPins.IsValidIndex(PinIndex))
 	{
-		// record for debugging, even if nothing is connected to this pin
-		TArray<FPinRecord>& Records = OutputRecords.FindOrAdd(PinName);
-		Records.Add(FPinRecord(FApp::GetCurrentTime(), ActivationType));
-
-#if WITH_EDITOR
-		if (GEditor && UFlowAsset::GetFlowGraphInterface().IsValid())
-		{
-			UFlowAsset::GetFlowGraphInterface()->OnOutputTriggered(GraphNode, OutputPins.IndexOfByKey(PinName));
-		}
-#endif // WITH_EDITOR
+#if !UE_BUILD_SHIPPING
+		LogInvalidPin(TEXT("Output Pin index"), FString::FromInt(PinIndex));
+#endif // UE_BUILD_SHIPPING
+		return;
 	}
-	else
+
+	const FName& PinName = OutputPins[PinIndex].PinName;
+
+#if !UE_BUILD_SHIPPING
+	if (IFlowInstanceObserver* Observer = GetFlowAsset()->GetInstanceObserver())
 	{
-		LogError(FString::Printf(TEXT("Output Pin name %s invalid"), *PinName.ToString()));
+		Observer->OnOutputTriggered(*this, PinIndex, ActivationType);
 	}
 #endif // UE_BUILD_SHIPPING
 
 	// call the next node
-	if (OutputPins.Contains(PinName) && Connections.Contains(PinName))
+	if (const FConnectedPin* FlowPin = Connections.Find(PinName))
 	{
-		const FConnectedPin FlowPin = GetConnection(PinName);
-		GetFlowAsset()->TriggerInput(FlowPin.NodeGuid, FlowPin.PinName);
+		GetFlowAsset()->TriggerInput(FlowPin->NodeGuid, FlowPin->PinName);
 	}
 }
 
@@ -697,7 +811,10 @@ void UFlowNode::Deactivate()
 
 void UFlowNode::Cleanup()
 {
-	K2_Cleanup();
+	if (IsInGameThread())
+	{
+		K2_Cleanup();
+	}
 }
 
 void UFlowNode::DeinitializeInstance()
@@ -720,6 +837,97 @@ void UFlowNode::ResetRecords()
 #endif
 }
 
+void UFlowNode::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	// reflected properties are already counted by UObject in EstimatedTotal mode
+	if (CumulativeResourceSize.GetResourceSizeMode() == EResourceSizeMode::Exclusive)
+	{
+		CumulativeResourceSize.AddDedicatedSystemMemoryBytes(InputPins.GetAllocatedSize() + OutputPins.GetAllocatedSize() + Connections.GetAllocatedSize());
+	}
+
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(GetPinRecordsAllocatedSize());
+}
+
+#if !UE_BUILD_SHIPPING
+void UFlowNode::LogInvalidPin(const TCHAR* PinDescription, const FString& Pin)
+{
+	LogError(FString::Printf(TEXT("%s %s invalid"), PinDescription, *Pin));
+}
+#endif
+
+SIZE_T UFlowNode::GetPinRecordsAllocatedSize() const
+{
+	SIZE_T Size = 0;
+
+#if !UE_BUILD_SHIPPING
+	auto AddRecordsSize = [&Size](const TMap<FName, TArray<FPinRecord>>& Records)
+	{
+		Size += Records.GetAllocatedSize();
+		for (const TPair<FName, TArray<FPinRecord>>& PinRecords : Records)
+		{
+			Size += PinRecords.Value.GetAllocatedSize();
+			for (const FPinRecord& Record : PinRecords.Value)
+			{
+				Size += Record.HumanReadableTime.GetAllocatedSize();
+			}
+		}
+	};
+
+	AddRecordsSize(InputRecords);
+	AddRecordsSize(OutputRecords);
+#endif
+
+	return Size;
+}
+
+FFlowTimerHandle UFlowNode::SetFlowTimer(const float Rate, const bool bLoop, const float FirstDelay /* = -1.0f */)
+{
+	if (UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
+	{
+		FFlowTimersScopeLock Lock(*FlowSubsystem);
+		return FlowSubsystem->GetFlowTimers().SetTimer(this, Rate, bLoop, FirstDelay);
+	}
+
+	return FFlowTimerHandle();
+}
+
+void UFlowNode::ClearFlowTimer(FFlowTimerHandle& Handle)
+{
+	if (UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
+	{
+		FFlowTimersScopeLock Lock(*FlowSubsystem);
+		FlowSubsystem->GetFlowTimers().ClearTimer(Handle);
+	}
+
+	Handle.Invalidate();
+}
+
+float UFlowNode::GetFlowTimerRemaining(const FFlowTimerHandle& Handle) const
+{
+	UFlowSubsystem* FlowSubsystem = GetFlowSubsystem();
+	if (FlowSubsystem == nullptr)
+	{
+		return -1.0f;
+	}
+
+	FFlowTimersScopeLock Lock(*FlowSubsystem);
+	return FlowSubsystem->GetFlowTimers().GetTimerRemaining(Handle);
+}
+
+float UFlowNode::GetFlowTimerElapsed(const FFlowTimerHandle& Handle) const
+{
+	UFlowSubsystem* FlowSubsystem = GetFlowSubsystem();
+	if (FlowSubsystem == nullptr)
+	{
+		return -1.0f;
+	}
+
+	FFlowTimersScopeLock Lock(*FlowSubsystem);
+	return FlowSubsystem->GetFlowTimers().GetTimerElapsed(Handle);
+}
+
 void UFlowNode::SaveInstance(FFlowNodeSaveData& NodeRecord)
 {
 	NodeRecord.NodeGuid = NodeGuid;
@@ -788,7 +996,8 @@ UFlowNode* UFlowNode::GetInspectedInstance() const
 {
 	if (const UFlowAsset* FlowInstance = GetFlowAsset()->GetInspectedInstance())
 	{
-		return FlowInstance->GetNode(GetGuid());
+		// inspecting instance shouldn't create nodes
+		return FlowInstance->FindInstancedNode(GetGuid());
 	}
 
 	return nullptr;
@@ -817,6 +1026,12 @@ TArray<FPinRecord> UFlowNode::GetPinRecords(const FName& PinName, const EEdGraph
 	}
 }
 
+const FPinRecord* UFlowNode::FindLastPinRecord(const FName& PinName, const EEdGraphPinDirection PinDirection) const
+{
+	const TArray<FPinRecord>* Records = PinDirection == EGPD_Input ? InputRecords.Find(PinName) : OutputRecords.Find(PinName);
+	return Records && Records->Num() > 0 ? &Records->Last() : nullptr;
+}
+
 FString UFlowNode::GetStatusString() const
 {
 	return K2_GetStatusString();
@@ -871,6 +1086,18 @@ FString UFlowNode::GetProgressAsString(const float Value)
 void UFlowNode::LogError(FString Message, const EFlowOnScreenMessageType OnScreenMessageType)
 {
 #if !UE_BUILD_SHIPPING
+	if (UFlowSubsystem::IsInParallelEvaluation())
+	{
+		UFlowSubsystem::RunOnGameThread([WeakThis = TWeakObjectPtr<UFlowNode>(this), Message, OnScreenMessageType]()
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->LogError(Message, OnScreenMessageType);
+			}
+		});
+		return;
+	}
+
 	if (BuildMessage(Message))
 	{
 		// OnScreen Message
@@ -908,6 +1135,18 @@ void UFlowNode::LogError(FString Message, const EFlowOnScreenMessageType OnScree
 void UFlowNode::LogWarning(FString Message)
 {
 #if !UE_BUILD_SHIPPING
+	if (UFlowSubsystem::IsInParallelEvaluation())
+	{
+		UFlowSubsystem::RunOnGameThread([WeakThis = TWeakObjectPtr<UFlowNode>(this), Message]()
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->LogWarning(Message);
+			}
+		});
+		return;
+	}
+
 	if (BuildMessage(Message))
 	{
 		// Output Log
@@ -924,6 +1163,18 @@ void UFlowNode::LogWarning(FString Message)
 void UFlowNode::LogNote(FString Message)
 {
 #if !UE_BUILD_SHIPPING
+	if (UFlowSubsystem::IsInParallelEvaluation())
+	{
+		UFlowSubsystem::RunOnGameThread([WeakThis = TWeakObjectPtr<UFlowNode>(this), Message]()
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->LogNote(Message);
+			}
+		});
+		return;
+	}
+
 	if (BuildMessage(Message))
 	{
 		// Output Log
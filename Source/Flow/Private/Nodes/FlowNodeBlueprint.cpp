@@ -8,3 +8,63 @@ UFlowNodeBlueprint::UFlowNodeBlueprint(const FObjectInitializer& ObjectInitializ
 	: Super(ObjectInitializer)
 {
 }
+
+#if WITH_EDITOR
+const FName FFlowNodeBlueprintTags::PlaceableTag(TEXT("FlowNodePlaceable"));
+const FName FFlowNodeBlueprintTags::CategoryTag(TEXT("FlowNodeCategory"));
+const FName FFlowNodeBlueprintTags::TitleTag(TEXT("FlowNodeTitle"));
+const FName FFlowNodeBlueprintTags::ToolTipTag(TEXT("FlowNodeToolTip"));
+const FName FFlowNodeBlueprintTags::KeywordsTag(TEXT("FlowNodeKeywords"));
+const FName FFlowNodeBlueprintTags::ClassHierarchyTag(TEXT("FlowNodeClassHierarchy"));
+const FName FFlowNodeBlueprintTags::AllowedAssetClassesTag(TEXT("FlowNodeAllowedAssetClasses"));
+const FName FFlowNodeBlueprintTags::DeniedAssetClassesTag(TEXT("FlowNodeDeniedAssetClasses"));
+
+bool FFlowNodeBlueprintTags::Read(const FAssetData& AssetData)
+{
+	auto ReadClassPaths = [&AssetData](const FName& Tag, TArray<FName>& OutClassPaths)
+	{
+		FString TagValue;
+		if (AssetData.GetTagValue(Tag, TagValue))
+		{
+			TArray<FString> ClassPaths;
+			TagValue.ParseIntoArray(ClassPaths, TEXT(","));
+
+			for (const FString& ClassPath : ClassPaths)
+			{
+				OutClassPaths.Emplace(*ClassPath);
+			}
+		}
+	};
+
+	FString PlaceableValue;
+	if (!AssetData.GetTagValue(PlaceableTag, PlaceableValue))
+	{
+		return false;
+	}
+
+	ReadClassPaths(ClassHierarchyTag, ClassHierarchy);
+	if (ClassHierarchy.Num() == 0)
+	{
+		return false;
+	}
+
+	bPlaceable = PlaceableValue.ToBool();
+	AssetData.GetTagValue(CategoryTag, Category);
+	AssetData.GetTagValue(KeywordsTag, Keywords);
+
+	FString TextValue;
+	if (AssetData.GetTagValue(TitleTag, TextValue))
+	{
+		Title = FText::FromString(TextValue);
+	}
+	if (AssetData.GetTagValue(ToolTipTag, TextValue))
+	{
+		ToolTip = FText::FromString(TextValue);
+	}
+
+	ReadClassPaths(AllowedAssetClassesTag, AllowedAssetClasses);
+	ReadClassPaths(DeniedAssetClassesTag, DeniedAssetClasses);
+
+	return true;
+}
+#endif
@@ -6,20 +6,34 @@
 
 UFlowNode_LogicalAND::UFlowNode_LogicalAND(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, NumExecutedInputs(0)
 {
 #if WITH_EDITOR
 	Category = TEXT("Operators");
 	NodeStyle = EFlowNodeStyle::Logic;
 #endif
 
+	ThreadSafeClass = StaticClass();
+
 	SetNumberedInputPins(0, 1);
 }
 
-void UFlowNode_LogicalAND::ExecuteInput(const FName& PinName)
+void UFlowNode_LogicalAND::InitializeInstance()
+{
+	Super::InitializeInstance();
+
+	ExecutedInputs.Init(false, InputPins.Num());
+}
+
+void UFlowNode_LogicalAND::ExecuteInputByIndex(const int32 PinIndex)
 {
-	ExecutedInputNames.Add(PinName);
+	if (!ExecutedInputs[PinIndex])
+	{
+		ExecutedInputs[PinIndex] = true;
+		NumExecutedInputs++;
+	}
 
-	if (ExecutedInputNames.Num() == InputPins.Num())
+	if (NumExecutedInputs == InputPins.Num())
 	{
 		TriggerFirstOutput(true);
 	}
@@ -27,5 +41,32 @@ void UFlowNode_LogicalAND::ExecuteInput(const FName& PinName)
 
 void UFlowNode_LogicalAND::Cleanup()
 {
+	ExecutedInputs.SetRange(0, ExecutedInputs.Num(), false);
+	NumExecutedInputs = 0;
+}
+
+void UFlowNode_LogicalAND::OnSave_Implementation()
+{
+	ExecutedInputNames.Reset();
+	for (TConstSetBitIterator<> It(ExecutedInputs); It; ++It)
+	{
+		ExecutedInputNames.Add(InputPins[It.GetIndex()].PinName);
+	}
+}
+
+void UFlowNode_LogicalAND::OnLoad_Implementation()
+{
+	Cleanup();
+
+	for (const FName& PinName : ExecutedInputNames)
+	{
+		const int32 PinIndex = InputPins.IndexOfByKey(PinName);
+		if (PinIndex != INDEX_NONE && !ExecutedInputs[PinIndex])
+		{
+			ExecutedInputs[PinIndex] = true;
+			NumExecutedInputs++;
+		}
+	}
+
 	ExecutedInputNames.Empty();
 }
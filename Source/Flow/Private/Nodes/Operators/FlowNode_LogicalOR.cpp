@@ -4,6 +4,13 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNode_LogicalOR)
 
+namespace FlowNode_LogicalORPins
+{
+	enum EInput : int32 { Enable, Disable };
+
+	const TCHAR* const Inputs[] = {TEXT("Enable"), TEXT("Disable")};
+}
+
 UFlowNode_LogicalOR::UFlowNode_LogicalOR(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, bEnabled(true)
@@ -15,14 +22,25 @@ UFlowNode_LogicalOR::UFlowNode_LogicalOR(const FObjectInitializer& ObjectInitial
 	NodeStyle = EFlowNodeStyle::Logic;
 #endif
 
+	ThreadSafeClass = StaticClass();
+
 	SetNumberedInputPins(0, 1);
-	InputPins.Add(FFlowPin(TEXT("Enable"), TEXT("Enabling resets Execution Count")));
-	InputPins.Add(FFlowPin(TEXT("Disable"), TEXT("Disabling resets Execution Count")));
+	InputPins.Add(FFlowPin(FlowNode_LogicalORPins::Inputs[FlowNode_LogicalORPins::Enable], TEXT("Enabling resets Execution Count")));
+	InputPins.Add(FFlowPin(FlowNode_LogicalORPins::Inputs[FlowNode_LogicalORPins::Disable], TEXT("Disabling resets Execution Count")));
 }
 
-void UFlowNode_LogicalOR::ExecuteInput(const FName& PinName)
+void UFlowNode_LogicalOR::InitializeInstance()
 {
-	if (PinName == TEXT("Enable"))
+	Super::InitializeInstance();
+
+	InputTable.Bind(FlowNode_LogicalORPins::Inputs, InputPins);
+}
+
+void UFlowNode_LogicalOR::ExecuteInputByIndex(const int32 PinIndex)
+{
+	using namespace FlowNode_LogicalORPins;
+
+	if (PinIndex == InputTable[EInput::Enable])
 	{
 		if (!bEnabled)
 		{
@@ -32,7 +50,7 @@ void UFlowNode_LogicalOR::ExecuteInput(const FName& PinName)
 		return;
 	}
 
-	if (PinName == TEXT("Disable"))
+	if (PinIndex == InputTable[EInput::Disable])
 	{
 		if (bEnabled)
 		{
@@ -42,7 +60,8 @@ void UFlowNode_LogicalOR::ExecuteInput(const FName& PinName)
 		return;
 	}
 
-	if (bEnabled && PinName.ToString().IsNumeric())
+	// every other input is a numbered pin
+	if (bEnabled)
 	{
 		ExecutionCount++;
 		if (ExecutionLimit > 0 && ExecutionCount == ExecutionLimit)
@@ -4,6 +4,15 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNode_Counter)
 
+namespace FlowNode_CounterPins
+{
+	enum EInput : int32 { Increment, Decrement, Skip };
+	enum EOutput : int32 { Zero, Step, Goal, Skipped };
+
+	const TCHAR* const Inputs[] = {TEXT("Increment"), TEXT("Decrement"), TEXT("Skip")};
+	const TCHAR* const Outputs[] = {TEXT("Zero"), TEXT("Step"), TEXT("Goal"), TEXT("Skipped")};
+}
+
 UFlowNode_Counter::UFlowNode_Counter(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, Goal(2)
@@ -14,51 +23,64 @@ UFlowNode_Counter::UFlowNode_Counter(const FObjectInitializer& ObjectInitializer
 	NodeStyle = EFlowNodeStyle::Condition;
 #endif
 
+	ThreadSafeClass = StaticClass();
+
 	InputPins.Empty();
-	InputPins.Add(FFlowPin(TEXT("Increment")));
-	InputPins.Add(FFlowPin(TEXT("Decrement")));
-	InputPins.Add(FFlowPin(TEXT("Skip")));
+	for (const TCHAR* PinName : FlowNode_CounterPins::Inputs)
+	{
+		InputPins.Add(FFlowPin(PinName));
+	}
 
 	OutputPins.Empty();
-	OutputPins.Add(FFlowPin(TEXT("Zero")));
-	OutputPins.Add(FFlowPin(TEXT("Step")));
-	OutputPins.Add(FFlowPin(TEXT("Goal")));
-	OutputPins.Add(FFlowPin(TEXT("Skipped")));
+	for (const TCHAR* PinName : FlowNode_CounterPins::Outputs)
+	{
+		OutputPins.Add(FFlowPin(PinName));
+	}
 }
 
-void UFlowNode_Counter::ExecuteInput(const FName& PinName)
+void UFlowNode_Counter::InitializeInstance()
 {
-	if (PinName == TEXT("Increment"))
+	Super::InitializeInstance();
+
+	InputTable.Bind(FlowNode_CounterPins::Inputs, InputPins);
+	OutputTable.Bind(FlowNode_CounterPins::Outputs, OutputPins);
+}
+
+void UFlowNode_Counter::ExecuteInputByIndex(const int32 PinIndex)
+{
+	using namespace FlowNode_CounterPins;
+
+	if (PinIndex == InputTable[EInput::Increment])
 	{
 		CurrentSum++;
 		if (CurrentSum == Goal)
 		{
-			TriggerOutput(TEXT("Goal"), true);
+			TriggerOutputByIndex(OutputTable[EOutput::Goal], true);
 		}
 		else
 		{
-			TriggerOutput(TEXT("Step"));
+			TriggerOutputByIndex(OutputTable[EOutput::Step]);
 		}
 		return;
 	}
 
-	if (PinName == TEXT("Decrement"))
+	if (PinIndex == InputTable[EInput::Decrement])
 	{
 		CurrentSum--;
 		if (CurrentSum == 0)
 		{
-			TriggerOutput(TEXT("Zero"), true);
+			TriggerOutputByIndex(OutputTable[EOutput::Zero], true);
 		}
 		else
 		{
-			TriggerOutput(TEXT("Step"));
+			TriggerOutputByIndex(OutputTable[EOutput::Step]);
 		}
 		return;
 	}
 
-	if (PinName == TEXT("Skip"))
+	if (PinIndex == InputTable[EInput::Skip])
 	{
-		TriggerOutput(TEXT("Skipped"), true);
+		TriggerOutputByIndex(OutputTable[EOutput::Skipped], true);
 	}
 }
 
@@ -10,6 +10,8 @@
 UFlowNode_CustomInput::UFlowNode_CustomInput(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
+	ThreadSafeClass = StaticClass();
+
 	InputPins.Empty();
 }
 
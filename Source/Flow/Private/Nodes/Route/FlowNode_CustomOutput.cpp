@@ -10,10 +10,20 @@
 
 UFlowNode_CustomOutput::UFlowNode_CustomOutput(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, EventIndex(INDEX_NONE)
 {
+	ThreadSafeClass = StaticClass();
+
 	OutputPins.Empty();
 }
 
+void UFlowNode_CustomOutput::InitializeInstance()
+{
+	Super::InitializeInstance();
+
+	EventIndex = EventName.IsNone() ? INDEX_NONE : GetFlowAsset()->GetCustomOutputEvents().Find(EventName);
+}
+
 void UFlowNode_CustomOutput::ExecuteInput(const FName& PinName)
 {
 	UFlowAsset* FlowAsset = GetFlowAsset();
@@ -25,7 +35,7 @@ void UFlowNode_CustomOutput::ExecuteInput(const FName& PinName)
 		                           *GetName(),
 		                           *FlowAsset->GetPathName()));
 	}
-	else if (!FlowAsset->TryFindCustomOutputNodeByEventName(EventName))
+	else if (EventIndex == INDEX_NONE)
 	{
 		const TArray<FName> OutputNames = FlowAsset->GatherCustomOutputNodeEventNames();
 		FString CustomOutputsString;
@@ -48,7 +58,7 @@ void UFlowNode_CustomOutput::ExecuteInput(const FName& PinName)
 	}
 	else
 	{
-		FlowAsset->TriggerCustomOutput(EventName);
+		FlowAsset->TriggerCustomOutputByIndex(EventIndex);
 	}
 }
 
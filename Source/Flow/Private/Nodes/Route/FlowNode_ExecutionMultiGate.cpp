@@ -4,39 +4,65 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNode_ExecutionMultiGate)
 
+namespace FlowNode_ExecutionMultiGatePins
+{
+	enum EInput : int32 { In, Reset };
+
+	const TCHAR* const Inputs[] = {TEXT("In"), TEXT("Reset")};
+}
+
 UFlowNode_ExecutionMultiGate::UFlowNode_ExecutionMultiGate(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, StartIndex(INDEX_NONE)
+	, NumCompletedOutputs(0)
 {
 #if WITH_EDITOR
 	Category = TEXT("Route");
 	NodeStyle = EFlowNodeStyle::Logic;
 #endif
 
+	ThreadSafeClass = StaticClass();
+
 	FString ResetPinTooltip = TEXT("Finish work of this node.");
 	ResetPinTooltip += LINE_TERMINATOR;
 	ResetPinTooltip += TEXT("Calling In input will start triggering output pins once again.");
 
-	InputPins.Add(FFlowPin(TEXT("Reset"), ResetPinTooltip));
+	InputPins.Add(FFlowPin(FlowNode_ExecutionMultiGatePins::Inputs[FlowNode_ExecutionMultiGatePins::Reset], ResetPinTooltip));
 	SetNumberedOutputPins(0, 1);
 	AllowedSignalModes = {EFlowSignalMode::Enabled, EFlowSignalMode::Disabled};
 }
 
-void UFlowNode_ExecutionMultiGate::ExecuteInput(const FName& PinName)
+void UFlowNode_ExecutionMultiGate::InitializeInstance()
 {
-	if (PinName == DefaultInputPin.PinName)
+	Super::InitializeInstance();
+
+	InputTable.Bind(FlowNode_ExecutionMultiGatePins::Inputs, InputPins);
+	CompletedOutputs.Init(false, OutputPins.Num());
+}
+
+void UFlowNode_ExecutionMultiGate::OnActivate()
+{
+	Super::OnActivate();
+
+	if (bRandom)
 	{
-		if (Completed.Num() == 0)
-		{
-			Completed.Init(false, OutputPins.Num());
-		}
+		RandomStream.Initialize(static_cast<int32>(FPlatformTime::Cycles() ^ GetUniqueID()));
+	}
+}
 
-		if (!Completed.Contains(false))
+void UFlowNode_ExecutionMultiGate::ExecuteInputByIndex(const int32 PinIndex)
+{
+	using namespace FlowNode_ExecutionMultiGatePins;
+
+	if (PinIndex == InputTable[EInput::In])
+	{
+		const int32 NumOutputs = CompletedOutputs.Num();
+		if (NumCompletedOutputs == NumOutputs)
 		{
 			return;
 		}
 
-		const bool bUseStartIndex = !Completed.Contains(true) && Completed.IsValidIndex(StartIndex);
+		const bool bUseStartIndex = NumCompletedOutputs == 0 && CompletedOutputs.IsValidIndex(StartIndex);
 
 		if (bRandom)
 		{
@@ -47,23 +73,19 @@ void UFlowNode_ExecutionMultiGate::ExecuteInput(const FName& PinName)
 			}
 			else
 			{
-				TArray<int32> AvailableIndexes;
-				AvailableIndexes.Reserve(Completed.Num()); // todo
-
-				for (int32 i = 0; i < Completed.Num(); i++)
+				// pick N-th available output, without collecting available indexes
+				int32 Random = RandomStream.RandRange(0, NumOutputs - NumCompletedOutputs - 1);
+				for (Index = 0; Index < NumOutputs; Index++)
 				{
-					if (Completed[i] == false)
+					if (!CompletedOutputs[Index] && Random-- == 0)
 					{
-						AvailableIndexes.Emplace(i);
+						break;
 					}
 				}
-
-				const int32 Random = FMath::RandRange(0, AvailableIndexes.Num() - 1);
-				Index = AvailableIndexes[Random];
 			}
 
-			Completed[Index] = true;
-			TriggerOutput(OutputPins[Index].PinName, false);
+			MarkCompleted(Index);
+			TriggerOutputByIndex(Index, false);
 		}
 		else
 		{
@@ -75,18 +97,18 @@ void UFlowNode_ExecutionMultiGate::ExecuteInput(const FName& PinName)
 			const int32 CurrentOutput = NextOutput;
 			// We have to calculate NextOutput before TriggerOutput(..)
 			// TriggerOutput may call Reset and Cleanup
-			NextOutput = ++NextOutput % OutputPins.Num();
+			NextOutput = (CurrentOutput + 1) % NumOutputs;
 
-			Completed[CurrentOutput] = true;
-			TriggerOutput(OutputPins[CurrentOutput].PinName, false);
+			MarkCompleted(CurrentOutput);
+			TriggerOutputByIndex(CurrentOutput, false);
 		}
 
-		if (!Completed.Contains(false) && bLoop)
+		if (NumCompletedOutputs == NumOutputs && bLoop)
 		{
 			Finish();
 		}
 	}
-	else if (PinName == TEXT("Reset"))
+	else if (PinIndex == InputTable[EInput::Reset])
 	{
 		Finish();
 	}
@@ -95,7 +117,42 @@ void UFlowNode_ExecutionMultiGate::ExecuteInput(const FName& PinName)
 void UFlowNode_ExecutionMultiGate::Cleanup()
 {
 	NextOutput = 0;
-	Completed.Reset();
+	CompletedOutputs.SetRange(0, CompletedOutputs.Num(), false);
+	NumCompletedOutputs = 0;
+}
+
+void UFlowNode_ExecutionMultiGate::OnSave_Implementation()
+{
+	Completed.SetNumUninitialized(CompletedOutputs.Num());
+	for (int32 Index = 0; Index < CompletedOutputs.Num(); Index++)
+	{
+		Completed[Index] = CompletedOutputs[Index];
+	}
+}
+
+void UFlowNode_ExecutionMultiGate::OnLoad_Implementation()
+{
+	CompletedOutputs.SetRange(0, CompletedOutputs.Num(), false);
+	NumCompletedOutputs = 0;
+
+	for (int32 Index = 0; Index < Completed.Num() && Index < CompletedOutputs.Num(); Index++)
+	{
+		if (Completed[Index])
+		{
+			MarkCompleted(Index);
+		}
+	}
+
+	Completed.Empty();
+}
+
+void UFlowNode_ExecutionMultiGate::MarkCompleted(const int32 OutputIndex)
+{
+	if (!CompletedOutputs[OutputIndex])
+	{
+		CompletedOutputs[OutputIndex] = true;
+		NumCompletedOutputs++;
+	}
 }
 
 #if WITH_EDITOR
@@ -13,6 +13,8 @@ UFlowNode_ExecutionSequence::UFlowNode_ExecutionSequence(const FObjectInitialize
 	NodeStyle = EFlowNodeStyle::Logic;
 #endif
 
+	ThreadSafeClass = StaticClass();
+
 	SetNumberedOutputPins(0, 1);
 	AllowedSignalModes = {EFlowSignalMode::Enabled, EFlowSignalMode::Disabled};
 }
@@ -25,9 +27,9 @@ void UFlowNode_ExecutionSequence::ExecuteInput(const FName& PinName)
 	}
 	else
 	{
-		for (const FFlowPin& Output : OutputPins)
+		for (int32 Index = 0; Index < OutputPins.Num(); Index++)
 		{
-			TriggerOutput(Output.PinName, false);
+			TriggerOutputByIndex(Index, false);
 		}
 
 		Finish();
@@ -46,13 +48,13 @@ void UFlowNode_ExecutionSequence::Cleanup()
 
 void UFlowNode_ExecutionSequence::ExecuteNewConnections()
 {
-	for (const FFlowPin& Output : OutputPins)
+	for (int32 Index = 0; Index < OutputPins.Num(); Index++)
 	{
-		const FConnectedPin& Connection = GetConnection(Output.PinName);
+		const FConnectedPin& Connection = GetConnection(OutputPins[Index].PinName);
 		if (!ExecutedConnections.Contains(Connection.NodeGuid))
 		{
 			ExecutedConnections.Emplace(Connection.NodeGuid);
-			TriggerOutput(Output.PinName, false);
+			TriggerOutputByIndex(Index, false);
 		}
 	}
 
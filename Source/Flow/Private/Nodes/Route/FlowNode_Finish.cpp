@@ -12,6 +12,8 @@ UFlowNode_Finish::UFlowNode_Finish(const FObjectInitializer& ObjectInitializer)
 	NodeStyle = EFlowNodeStyle::InOut;
 #endif
 
+	ThreadSafeClass = StaticClass();
+
 	OutputPins = {};
 	AllowedSignalModes = {EFlowSignalMode::Enabled, EFlowSignalMode::Disabled};
 }
@@ -11,6 +11,8 @@ UFlowNode_Reroute::UFlowNode_Reroute(const FObjectInitializer& ObjectInitializer
 	Category = TEXT("Route");
 #endif
 
+	ThreadSafeClass = StaticClass();
+
 	AllowedSignalModes = {EFlowSignalMode::Enabled, EFlowSignalMode::Disabled};
 }
 
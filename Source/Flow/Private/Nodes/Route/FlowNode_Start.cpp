@@ -13,6 +13,8 @@ UFlowNode_Start::UFlowNode_Start(const FObjectInitializer& ObjectInitializer)
 	bCanDelete = bCanDuplicate = false;
 #endif
 
+	ThreadSafeClass = StaticClass();
+
 	InputPins = {};
 	AllowedSignalModes = {EFlowSignalMode::Enabled, EFlowSignalMode::Disabled};
 }
@@ -14,6 +14,7 @@ FFlowPin UFlowNode_SubGraph::FinishPin(TEXT("Finish"));
 UFlowNode_SubGraph::UFlowNode_SubGraph(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, bCanInstanceIdenticalAsset(false)
+	, ExecutedInputIndex(INDEX_NONE)
 {
 #if WITH_EDITOR
 	Category = TEXT("Route");
@@ -47,6 +48,12 @@ void UFlowNode_SubGraph::FlushContent()
 	}
 }
 
+void UFlowNode_SubGraph::ExecuteInputByIndex(const int32 PinIndex)
+{
+	TGuardValue<int32> ExecutedInputGuard(ExecutedInputIndex, PinIndex);
+	Super::ExecuteInputByIndex(PinIndex);
+}
+
 void UFlowNode_SubGraph::ExecuteInput(const FName& PinName)
 {
 	if (CanBeAssetInstanced() == false)
@@ -64,7 +71,7 @@ void UFlowNode_SubGraph::ExecuteInput(const FName& PinName)
 		return;
 	}
 	
-	if (PinName == TEXT("Start"))
+	if (PinName == StartPin.PinName)
 	{
 		if (GetFlowSubsystem())
 		{
@@ -73,7 +80,20 @@ void UFlowNode_SubGraph::ExecuteInput(const FName& PinName)
 	}
 	else if (!PinName.IsNone())
 	{
-		GetFlowAsset()->TriggerCustomInput_FromSubGraph(this, PinName);
+		TriggerSubFlowCustomInput(PinName);
+	}
+}
+
+void UFlowNode_SubGraph::TriggerSubFlowCustomInput(const FName& EventName) const
+{
+	if (SubFlowInstance.IsValid())
+	{
+		// pin index is known if input has been triggered by TriggerInput, subclasses might call ExecuteInput directly
+		const int32 PinIndex = InputPins.IsValidIndex(ExecutedInputIndex) && InputPins[ExecutedInputIndex].PinName == EventName
+			? ExecutedInputIndex
+			: InputPins.IndexOfByKey(EventName);
+
+		SubFlowInstance->TriggerCustomInputByIndex(InputPinEvents.IsValidIndex(PinIndex) ? InputPinEvents[PinIndex] : INDEX_NONE);
 	}
 }
 
@@ -90,6 +110,13 @@ void UFlowNode_SubGraph::ForceFinishNode()
 	TriggerFirstOutput(true);
 }
 
+void UFlowNode_SubGraph::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(InputPinEvents.GetAllocatedSize());
+}
+
 void UFlowNode_SubGraph::OnLoad_Implementation()
 {
 	if (!SavedAssetInstanceName.IsEmpty() && !Asset.IsNull())
@@ -2,11 +2,19 @@
 
 #include "Nodes/Route/FlowNode_Timer.h"
 
-#include "Engine/World.h"
-#include "TimerManager.h"
-
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNode_Timer)
 
+// Node can be subclassed in projects, so it keeps reacting on pin names, without constructing FName per comparison
+namespace FlowNode_TimerPins
+{
+	static const FName Skip(TEXT("Skip"));
+	static const FName Restart(TEXT("Restart"));
+
+	static const FName Completed(TEXT("Completed"));
+	static const FName Step(TEXT("Step"));
+	static const FName Skipped(TEXT("Skipped"));
+}
+
 UFlowNode_Timer::UFlowNode_Timer(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, CompletionTime(1.0f)
@@ -20,18 +28,20 @@ UFlowNode_Timer::UFlowNode_Timer(const FObjectInitializer& ObjectInitializer)
 	NodeStyle = EFlowNodeStyle::Latent;
 #endif
 
-	InputPins.Add(FFlowPin(TEXT("Skip")));
-	InputPins.Add(FFlowPin(TEXT("Restart")));
+	ThreadSafeClass = StaticClass();
+
+	InputPins.Add(FFlowPin(FlowNode_TimerPins::Skip));
+	InputPins.Add(FFlowPin(FlowNode_TimerPins::Restart));
 
 	OutputPins.Empty();
-	OutputPins.Add(FFlowPin(TEXT("Completed")));
-	OutputPins.Add(FFlowPin(TEXT("Step")));
-	OutputPins.Add(FFlowPin(TEXT("Skipped")));
+	OutputPins.Add(FFlowPin(FlowNode_TimerPins::Completed));
+	OutputPins.Add(FFlowPin(FlowNode_TimerPins::Step));
+	OutputPins.Add(FFlowPin(FlowNode_TimerPins::Skipped));
 }
 
 void UFlowNode_Timer::ExecuteInput(const FName& PinName)
 {
-	if (PinName == TEXT("In"))
+	if (PinName == DefaultInputPin.PinName)
 	{
 		if (CompletionTimerHandle.IsValid() || StepTimerHandle.IsValid())
 		{
@@ -41,11 +51,11 @@ void UFlowNode_Timer::ExecuteInput(const FName& PinName)
 
 		SetTimer();
 	}
-	else if (PinName == TEXT("Skip"))
+	else if (PinName == FlowNode_TimerPins::Skip)
 	{
-		TriggerOutput(TEXT("Skipped"), true);
+		TriggerOutput(FlowNode_TimerPins::Skipped, true);
 	}
-	else if (PinName == TEXT("Restart"))
+	else if (PinName == FlowNode_TimerPins::Restart)
 	{
 		Restart();
 	}
@@ -53,26 +63,20 @@ void UFlowNode_Timer::ExecuteInput(const FName& PinName)
 
 void UFlowNode_Timer::SetTimer()
 {
-	if (GetWorld())
+	if (GetFlowSubsystem())
 	{
 		if (StepTime > 0.0f)
 		{
-			GetWorld()->GetTimerManager().SetTimer(StepTimerHandle, this, &UFlowNode_Timer::OnStep, StepTime, true);
+			StepTimerHandle = SetFlowTimer(StepTime, true);
 		}
 
-		if (CompletionTime > UE_KINDA_SMALL_NUMBER)
-		{
-			GetWorld()->GetTimerManager().SetTimer(CompletionTimerHandle, this, &UFlowNode_Timer::OnCompletion, CompletionTime, false);
-		}
-		else
-		{
-			GetWorld()->GetTimerManager().SetTimerForNextTick(this, &UFlowNode_Timer::OnCompletion);
-		}
+		// zero delay means completing in the next tick
+		CompletionTimerHandle = SetFlowTimer(CompletionTime > UE_KINDA_SMALL_NUMBER ? CompletionTime : 0.0f, false);
 	}
 	else
 	{
-		LogError(TEXT("No valid world"));
-		TriggerOutput(TEXT("Completed"), true);
+		LogError(TEXT("No valid Flow Subsystem"));
+		TriggerOutput(FlowNode_TimerPins::Completed, true);
 	}
 }
 
@@ -86,55 +90,56 @@ void UFlowNode_Timer::Restart()
 	SetTimer();
 }
 
+void UFlowNode_Timer::OnFlowTimer(const FFlowTimerHandle& Handle)
+{
+	if (Handle == StepTimerHandle)
+	{
+		OnStep();
+	}
+	else if (Handle == CompletionTimerHandle)
+	{
+		OnCompletion();
+	}
+}
+
 void UFlowNode_Timer::OnStep()
 {
 	SumOfSteps += StepTime;
 
 	if (SumOfSteps >= CompletionTime)
 	{
-		TriggerOutput(TEXT("Completed"), true);
+		TriggerOutput(FlowNode_TimerPins::Completed, true);
 	}
 	else
 	{
-		TriggerOutput(TEXT("Step"));
+		TriggerOutput(FlowNode_TimerPins::Step);
 	}
 }
 
 void UFlowNode_Timer::OnCompletion()
 {
-	TriggerOutput(TEXT("Completed"), true);
+	TriggerOutput(FlowNode_TimerPins::Completed, true);
 }
 
 void UFlowNode_Timer::Cleanup()
 {
-	if (GetWorld())
-	{
-		GetWorld()->GetTimerManager().ClearTimer(CompletionTimerHandle);
-	}
-	CompletionTimerHandle.Invalidate();
-
-	if (GetWorld())
-	{
-		GetWorld()->GetTimerManager().ClearTimer(StepTimerHandle);
-	}
-	StepTimerHandle.Invalidate();
+	ClearFlowTimer(CompletionTimerHandle);
+	ClearFlowTimer(StepTimerHandle);
 
 	SumOfSteps = 0.0f;
 }
 
 void UFlowNode_Timer::OnSave_Implementation()
 {
-	if (GetWorld())
+	// remaining time is measured in time of this Flow Asset instance, so time dilation doesn't affect saved values
+	if (CompletionTimerHandle.IsValid())
 	{
-		if (CompletionTimerHandle.IsValid())
-		{
-			RemainingCompletionTime = GetWorld()->GetTimerManager().GetTimerRemaining(CompletionTimerHandle);
-		}
+		RemainingCompletionTime = GetFlowTimerRemaining(CompletionTimerHandle);
+	}
 
-		if (StepTimerHandle.IsValid())
-		{
-			RemainingStepTime = GetWorld()->GetTimerManager().GetTimerRemaining(StepTimerHandle);
-		}
+	if (StepTimerHandle.IsValid())
+	{
+		RemainingStepTime = GetFlowTimerRemaining(StepTimerHandle);
 	}
 }
 
@@ -144,10 +149,10 @@ void UFlowNode_Timer::OnLoad_Implementation()
 	{
 		if (RemainingStepTime > 0.0f)
 		{
-			GetWorld()->GetTimerManager().SetTimer(StepTimerHandle, this, &UFlowNode_Timer::OnStep, StepTime, true, RemainingStepTime);
+			StepTimerHandle = SetFlowTimer(StepTime, true, RemainingStepTime);
 		}
 
-		GetWorld()->GetTimerManager().SetTimer(CompletionTimerHandle, this, &UFlowNode_Timer::OnCompletion, RemainingCompletionTime, false);
+		CompletionTimerHandle = SetFlowTimer(RemainingCompletionTime, false);
 
 		RemainingStepTime = 0.0f;
 		RemainingCompletionTime = 0.0f;
@@ -177,9 +182,9 @@ FString UFlowNode_Timer::GetStatusString() const
 		return FString::Printf(TEXT("Progress: %.*f"), 2, SumOfSteps);
 	}
 
-	if (CompletionTimerHandle.IsValid() && GetWorld())
+	if (CompletionTimerHandle.IsValid())
 	{
-		return FString::Printf(TEXT("Progress: %.*f"), 2, GetWorld()->GetTimerManager().GetTimerElapsed(CompletionTimerHandle));
+		return FString::Printf(TEXT("Progress: %.*f"), 2, GetFlowTimerElapsed(CompletionTimerHandle));
 	}
 
 	return FString();
@@ -22,6 +22,22 @@ UFlowNode_CallOwnerFunction::UFlowNode_CallOwnerFunction(const FObjectInitialize
 #endif
 }
 
+void UFlowNode_CallOwnerFunction::InitializeInstance()
+{
+	Super::InitializeInstance();
+
+	ValidOutputNames.Reset();
+	ValidOutputNames.Append(GetOutputNames());
+
+	if (IsValid(Params))
+	{
+		Params->InitializeInstance();
+	}
+
+	// resolve function up front, so execution doesn't need to look it up
+	(void)TryResolveOwnerFunction(false);
+}
+
 void UFlowNode_CallOwnerFunction::ExecuteInput(const FName& PinName)
 {
 	Super::ExecuteInput(PinName);
@@ -33,37 +49,56 @@ void UFlowNode_CallOwnerFunction::ExecuteInput(const FName& PinName)
 		return;
 	}
 
+	UObject* FlowOwnerObject = ResolvedOwnerObject.Get();
+	if (FlowOwnerObject == nullptr || !FunctionRef.IsResolved())
+	{
+		FlowOwnerObject = TryResolveOwnerFunction(true);
+		if (FlowOwnerObject == nullptr)
+		{
+			return;
+		}
+	}
+
+	Params->PreExecute(*this, PinName);
+
+	const FName ResultOutputName = FunctionRef.CallFunction(*FlowOwnerObject, *Params, ValidOutputNames);
+
+	Params->PostExecute();
+
+	(void)TryExecuteOutputPin(ResultOutputName);
+}
+
+UObject* UFlowNode_CallOwnerFunction::TryResolveOwnerFunction(const bool bLogErrors)
+{
+	ResolvedOwnerObject.Reset();
+
 	IFlowOwnerInterface* FlowOwnerInterface = GetFlowOwnerInterface();
 	if (!FlowOwnerInterface)
 	{
-		UE_LOG(LogFlow, Error, TEXT("Expected an owner that implements the IFlowOwnerInterface"));
+		UE_CLOG(bLogErrors, LogFlow, Error, TEXT("Expected an owner that implements the IFlowOwnerInterface"));
 
-		return;
+		return nullptr;
 	}
 
-	const UObject* FlowOwnerObject = CastChecked<UObject>(FlowOwnerInterface);
+	UObject* FlowOwnerObject = CastChecked<UObject>(FlowOwnerInterface);
 	const UClass* FlowOwnerClass = FlowOwnerObject->GetClass();
 	check(IsValid(FlowOwnerClass));
 
 	if (!FunctionRef.TryResolveFunction(*FlowOwnerClass))
 	{
-		UE_LOG(
+		UE_CLOG(
+			bLogErrors,
 			LogFlow,
 			Error,
 			TEXT("Could not resolve function named %s with flow owner class %s"),
 			*FunctionRef.GetFunctionName().ToString(),
 			*FlowOwnerClass->GetName());
 
-		return;
+		return nullptr;
 	}
 
-	Params->PreExecute(*this, PinName);
-
-	const FName ResultOutputName = FunctionRef.CallFunction(*FlowOwnerInterface, *Params);
-
-	Params->PostExecute();
-
-	(void)TryExecuteOutputPin(ResultOutputName);
+	ResolvedOwnerObject = FlowOwnerObject;
+	return FlowOwnerObject;
 }
 
 bool UFlowNode_CallOwnerFunction::TryExecuteOutputPin(const FName& OutputName)
@@ -5,6 +5,17 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNode_ComponentObserver)
 
+// Node is subclassed by other nodes, so it keeps reacting on pin names, without constructing FName per comparison
+namespace FlowNode_ComponentObserverPins
+{
+	static const FName Start(TEXT("Start"));
+	static const FName Stop(TEXT("Stop"));
+
+	static const FName Success(TEXT("Success"));
+	static const FName Completed(TEXT("Completed"));
+	static const FName Stopped(TEXT("Stopped"));
+}
+
 UFlowNode_ComponentObserver::UFlowNode_ComponentObserver(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, IdentityMatchType(EFlowTagContainerMatchType::HasAnyExact)
@@ -16,21 +27,21 @@ UFlowNode_ComponentObserver::UFlowNode_ComponentObserver(const FObjectInitialize
 	Category = TEXT("World");
 #endif
 
-	InputPins = {FFlowPin(TEXT("Start")), FFlowPin(TEXT("Stop"))};
-	OutputPins = {FFlowPin(TEXT("Success")), FFlowPin(TEXT("Completed")), FFlowPin(TEXT("Stopped"))};
+	InputPins = {FFlowPin(FlowNode_ComponentObserverPins::Start), FFlowPin(FlowNode_ComponentObserverPins::Stop)};
+	OutputPins = {FFlowPin(FlowNode_ComponentObserverPins::Success), FFlowPin(FlowNode_ComponentObserverPins::Completed), FFlowPin(FlowNode_ComponentObserverPins::Stopped)};
 }
 
 void UFlowNode_ComponentObserver::ExecuteInput(const FName& PinName)
 {
 	if (IdentityTags.IsValid())
 	{
-		if (PinName == TEXT("Start"))
+		if (PinName == FlowNode_ComponentObserverPins::Start)
 		{
 			StartObserving();
 		}
-		else if (PinName == TEXT("Stop"))
+		else if (PinName == FlowNode_ComponentObserverPins::Stop)
 		{
-			TriggerOutput(TEXT("Stopped"), true);
+			TriggerOutput(FlowNode_ComponentObserverPins::Stopped, true);
 		}
 	}
 	else
@@ -127,7 +138,7 @@ void UFlowNode_ComponentObserver::OnEventReceived()
 	SuccessCount++;
 	if (SuccessLimit > 0 && SuccessCount == SuccessLimit)
 	{
-		TriggerOutput(TEXT("Completed"), true);
+		TriggerOutput(FlowNode_ComponentObserverPins::Completed, true);
 	}
 }
 
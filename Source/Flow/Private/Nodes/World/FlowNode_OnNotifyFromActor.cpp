@@ -2,12 +2,14 @@
 
 #include "Nodes/World/FlowNode_OnNotifyFromActor.h"
 #include "FlowComponent.h"
+#include "FlowSubsystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNode_OnNotifyFromActor)
 
 UFlowNode_OnNotifyFromActor::UFlowNode_OnNotifyFromActor(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, bRetroactive(false)
+	, bNotifyInterestRegistered(false)
 {
 #if WITH_EDITOR
 	Category = TEXT("Notifies");
@@ -15,6 +17,34 @@ UFlowNode_OnNotifyFromActor::UFlowNode_OnNotifyFromActor(const FObjectInitialize
 #endif
 }
 
+void UFlowNode_OnNotifyFromActor::StartObserving()
+{
+	if (!bNotifyInterestRegistered)
+	{
+		if (UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
+		{
+			FlowSubsystem->AddNotifyInterest(IdentityTags, NotifyTags);
+			bNotifyInterestRegistered = true;
+		}
+	}
+
+	Super::StartObserving();
+}
+
+void UFlowNode_OnNotifyFromActor::StopObserving()
+{
+	if (bNotifyInterestRegistered)
+	{
+		if (UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
+		{
+			FlowSubsystem->RemoveNotifyInterest(IdentityTags, NotifyTags);
+		}
+		bNotifyInterestRegistered = false;
+	}
+
+	Super::StopObserving();
+}
+
 void UFlowNode_OnNotifyFromActor::ObserveActor(TWeakObjectPtr<AActor> Actor, TWeakObjectPtr<UFlowComponent> Component)
 {
 	if (!RegisteredActors.Contains(Actor))
@@ -142,8 +142,6 @@ void UFlowNode_PlayLevelSequence::CreatePlayer()
 	LoadedSequence = Sequence.LoadSynchronous();
 	if (LoadedSequence)
 	{
-		ALevelSequenceActor* SequenceActor;
-
 		AActor* OwningActor = TryGetRootFlowActorOwner();
 
 		// Apply AActor::CustomTimeDilation from owner of the Root Flow
@@ -155,8 +153,8 @@ void UFlowNode_PlayLevelSequence::CreatePlayer()
 		// Apply Transform Origin
 		AActor* TransformOriginActor = bUseGraphOwnerAsTransformOrigin ? OwningActor : nullptr;
 
-		// Finally create the player
-		SequencePlayer = UFlowLevelSequencePlayer::CreateFlowLevelSequencePlayer(this, LoadedSequence, PlaybackSettings, CameraSettings, TransformOriginActor, bReplicates, bAlwaysRelevant, SequenceActor);
+		// Finally get the player, reusing idle Sequence Actor if possible
+		SequencePlayer = GetFlowSubsystem()->AcquireLevelSequencePlayer(LoadedSequence, PlaybackSettings, CameraSettings, TransformOriginActor, bReplicates, bAlwaysRelevant);
 
 		if (SequencePlayer)
 		{
@@ -253,9 +251,9 @@ void UFlowNode_PlayLevelSequence::OnLoad_Implementation()
 	}
 }
 
-void UFlowNode_PlayLevelSequence::TriggerEvent(const FString& EventName)
+void UFlowNode_PlayLevelSequence::TriggerEvent(const FName& EventName)
 {
-	TriggerOutput(*EventName, false);
+	TriggerOutput(EventName, false);
 }
 
 void UFlowNode_PlayLevelSequence::OnTimeDilationUpdate(const float NewTimeDilation)
@@ -290,9 +288,18 @@ void UFlowNode_PlayLevelSequence::Cleanup()
 	{
 		SequencePlayer->SetFlowEventReceiver(nullptr);
 		SequencePlayer->OnFinished.RemoveAll(this);
+
+		// sequence paused at end keeps its last frame applied to the world, so it can't be reused
 		if (!PlaybackSettings.bPauseAtEnd)
 		{
-			SequencePlayer->Stop();
+			if (UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
+			{
+				FlowSubsystem->ReleaseLevelSequencePlayer(SequencePlayer);
+			}
+			else
+			{
+				SequencePlayer->Stop();
+			}
 		}
 		SequencePlayer = nullptr;
 	}
@@ -21,6 +21,23 @@ class UFlowSubsystem;
 class UEdGraph;
 class UEdGraphNode;
 class UFlowAsset;
+struct FFlowNodeBlueprintTags;
+
+#if !UE_BUILD_SHIPPING
+/**
+ * Debugging hooks of a single Flow Asset instance, installed only on instances being inspected
+ * Instances without an observer run the same signal path as in Shipping builds
+ * Called from worker threads, if the instance is evaluated in parallel
+ */
+class FLOW_API IFlowInstanceObserver
+{
+public:
+	virtual ~IFlowInstanceObserver() {}
+
+	virtual void OnInputTriggered(UFlowNode& Node, const int32 PinIndex, const EFlowPinActivationType ActivationType) {}
+	virtual void OnOutputTriggered(UFlowNode& Node, const int32 PinIndex, const EFlowPinActivationType ActivationType) {}
+};
+#endif
 
 #if WITH_EDITOR
 
@@ -33,12 +50,128 @@ public:
 
 	virtual void OnInputTriggered(UEdGraphNode* GraphNode, const int32 Index) const {}
 	virtual void OnOutputTriggered(UEdGraphNode* GraphNode, const int32 Index) const {}
+
+	// Uninspected instances report triggered pins to the editor only if the graph has breakpoints
+	virtual bool HasBreakpoints(const UFlowAsset& TemplateAsset) const { return false; }
 };
 
 DECLARE_DELEGATE(FFlowGraphEvent);
 
+/**
+ * While the scope is alive, node class rules are evaluated once per (asset class, node class) pair
+ * - rules depend only on class defaults, which don't change during batch operations like validating many assets
+ * - blueprint classes can be edited in the editor, so results aren't kept outside of the scope
+ */
+struct FLOW_API FFlowNodeClassRulesCacheScope
+{
+	FFlowNodeClassRulesCacheScope();
+	~FFlowNodeClassRulesCacheScope();
+
+private:
+	friend class UFlowAsset;
+
+	TMap<TPair<FObjectKey, FObjectKey>, bool> Results;
+	FFlowNodeClassRulesCacheScope* PreviousScope;
+
+	static FFlowNodeClassRulesCacheScope* ActiveScope;
+};
+
 #endif
 
+/**
+ * Names of custom events placed in the graph, the event index is shared by the template and its instances
+ * Lets graph instances and SubGraph nodes route custom events by index, without comparing names
+ */
+struct FLOW_API FFlowCustomEventIndex
+{
+	TArray<FName> EventNames;
+	TMap<FName, int32> EventIndices;
+
+	void Add(const FName& EventName)
+	{
+		if (!EventIndices.Contains(EventName))
+		{
+			EventIndices.Add(EventName, EventNames.Add(EventName));
+		}
+	}
+
+	int32 Find(const FName& EventName) const
+	{
+		const int32* EventIndex = EventIndices.Find(EventName);
+		return EventIndex ? *EventIndex : INDEX_NONE;
+	}
+
+	void Reset()
+	{
+		EventNames.Reset();
+		EventIndices.Reset();
+	}
+
+	SIZE_T GetAllocatedSize() const
+	{
+		return EventNames.GetAllocatedSize() + EventIndices.GetAllocatedSize();
+	}
+};
+
+/**
+ * Buffers reused by graph traversal queries, keeps their allocations between queries
+ */
+struct FFlowGraphTraversalScratch
+{
+	TBitArray<> IteratedNodes;
+
+	// node and the number of its connections already followed, replaces recursion
+	TArray<TPair<int32, int32>> NodeStack;
+
+	// Query results, available to callers that need only node indices
+	TArray<int32> NodeIndices;
+};
+
+/**
+ * Connections of the template graph, built once and shared by the template and its instances
+ * Nodes are addressed by their index in UFlowAsset::GetNodeIndexSpace, per-node ranges are stored contiguously
+ * Queries don't allocate, so graph traversal doesn't need to walk nodes' Connections again
+ */
+struct FLOW_API FFlowGraphTopology
+{
+	void Build(const TArray<FGuid>& NodeIndexSpace, const TMap<FGuid, UFlowNode*>& Nodes, const TArray<UFlowNode*>& EntryNodes);
+	void Reset();
+
+	bool IsBuilt() const { return bBuilt; }
+	int32 GetNumNodes() const { return FMath::Max(ConnectedNodeOffsets.Num() - 1, 0); }
+	bool IsValidNodeIndex(const int32 NodeIndex) const { return NodeIndex >= 0 && NodeIndex < GetNumNodes(); }
+
+	// Unique nodes connected to outputs of the node, in order of the node's Connections
+	TConstArrayView<int32> GetConnectedNodes(const int32 NodeIndex) const;
+
+	// Input pins of the node connected to any output
+	TConstArrayView<FName> GetConnectedInputs(const int32 NodeIndex) const;
+
+	// Nodes in execution order, precomputed only for entry nodes
+	const TArray<int32>* FindExecutionOrder(const int32 FirstNodeIndex) const { return ExecutionOrders.Find(FirstNodeIndex); }
+
+	// Nodes in execution order: depth-first, every node visited once
+	void GatherExecutionOrder(const int32 FirstNodeIndex, TArray<int32>& OutNodeIndices) const;
+	void GatherExecutionOrder(const int32 FirstNodeIndex, TArray<int32>& OutNodeIndices, FFlowGraphTraversalScratch& Scratch) const;
+
+	// Nodes of exactly this class
+	TConstArrayView<int32> GetNodesOfClass(const UClass* NodeClass) const;
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	TArray<int32> ConnectedNodeOffsets;
+	TArray<int32> ConnectedNodes;
+
+	TArray<int32> ConnectedInputOffsets;
+	TArray<FName> ConnectedInputs;
+
+	TMap<int32, TArray<int32>> ExecutionOrders;
+	TMap<const UClass*, TArray<int32>> NodesByClass;
+
+	bool bBuilt = false;
+};
+
 /**
  * Single asset containing flow nodes.
  */
@@ -65,9 +198,21 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Flow Asset")
 	bool bWorldBound;
 
+	// If enabled, instance creates only entry nodes on start, other nodes are created when signal reaches them for the first time
+	// Makes starting large graphs cheap, but node's InitializeInstance is called just before the node is used
+	// Graph with nodes instanced on demand is never evaluated on worker threads
+	UPROPERTY(EditAnywhere, Category = "Flow Asset")
+	bool bInstanceNodesOnDemand;
+
 //////////////////////////////////////////////////////////////////////////
 // Graph
 
+	// UObject
+	virtual void Serialize(FArchive& Ar) override;
+	virtual void PostLoad() override;
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+	// --
+
 #if WITH_EDITOR
 	friend class UFlowGraph;
 
@@ -75,7 +220,7 @@ public:
 	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 	virtual void PostDuplicate(bool bDuplicateForPIE) override;
-	virtual void PostLoad() override;
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
 	// --
 
 	virtual EDataValidationResult ValidateAsset(FFlowMessageLog& MessageLog);
@@ -83,13 +228,20 @@ public:
 	// Returns whether the node class is allowed in this flow asset
 	bool IsNodeClassAllowed(const UClass* FlowNodeClass, FText* OutOptionalFailureReason = nullptr) const;
 
+	// Variant checking the blueprint node by its asset registry tags, it doesn't load the blueprint
+	bool IsNodeClassAllowed(const FAssetData& FlowNodeAssetData, const FFlowNodeBlueprintTags& NodeTags, FText* OutOptionalFailureReason = nullptr) const;
+
 	static FString ValidationError_NodeClassNotAllowed;
 	static FString ValidationError_NullNodeInstance;
 
 protected:
+	// CanFlowNodeClassBeUsedByFlowAsset and CanFlowAssetUseFlowNodeClass, cached within FFlowNodeClassRulesCacheScope
+	bool AreNodeClassRulesMet(const UClass& FlowNodeClass) const;
+
 	bool CanFlowNodeClassBeUsedByFlowAsset(const UClass& FlowNodeClass) const;
 	bool CanFlowAssetUseFlowNodeClass(const UClass& FlowNodeClass) const;
 	bool CanFlowAssetReferenceFlowNode(const UClass& FlowNodeClass, FText* OutOptionalFailureReason = nullptr) const;
+	bool CanFlowAssetReferenceFlowNode(const FAssetData& FlowNodeAssetData, FText* OutOptionalFailureReason = nullptr) const;
 #endif
 
 	// IFlowGraphInterface
@@ -100,6 +252,9 @@ private:
 	TObjectPtr<UEdGraph> FlowGraph;
 
 	static TSharedPtr<IFlowGraphInterface> FlowGraphInterface;
+
+	// Graph might have changed since the last HarvestNodeConnections call
+	bool bNodeConnectionsDirty;
 #endif
 
 public:
@@ -127,6 +282,20 @@ private:
 	UPROPERTY()
 	TMap<FGuid, UFlowNode*> Nodes;
 
+	// Guids of all nodes in ascending order, built on demand
+	mutable TArray<FGuid> NodeIndexSpace;
+
+	// Cached result of CanEvaluateInParallel
+	mutable TOptional<bool> bCanEvaluateInParallel;
+
+	// Custom events of the template, indexed when the first instance is created
+	mutable FFlowCustomEventIndex CustomInputEvents;
+	mutable FFlowCustomEventIndex CustomOutputEvents;
+	mutable bool bCustomEventsIndexed;
+
+	// Connections of the template, built on demand
+	mutable FFlowGraphTopology GraphTopology;
+
 #if WITH_EDITORONLY_DATA
 protected:
 	/**
@@ -155,10 +324,46 @@ public:
 
 	// Processes all nodes and creates map of all pin connections
 	void HarvestNodeConnections();
+
+	// Harvests connections only if graph might have changed since the last harvest, i.e. before creating another instance
+	void HarvestNodeConnectionsIfDirty();
+	void MarkNodeConnectionsDirty() { bNodeConnectionsDirty = true; }
 #endif
 
-	const TMap<FGuid, UFlowNode*>& GetNodes() const { return Nodes; }
-	UFlowNode* GetNode(const FGuid& Guid) const { return Nodes.FindRef(Guid); }
+	// On instance with nodes created on demand, it creates all remaining nodes
+	const TMap<FGuid, UFlowNode*>& GetNodes() const;
+
+	// On instance with nodes created on demand, it creates the node if needed
+	UFlowNode* GetNode(const FGuid& Guid) const;
+
+	// Returns node only if it's already created, doesn't affect instance with nodes created on demand
+	UFlowNode* FindInstancedNode(const FGuid& Guid) const { return Nodes.FindRef(Guid); }
+
+private:
+	// Nodes describing the graph, template nodes are used if instance didn't create all nodes yet
+	const TMap<FGuid, UFlowNode*>& GetGraphNodes() const;
+
+public:
+
+	// Node indices are shared by the template and its instances, so they are identical on server and clients
+	const TArray<FGuid>& GetNodeIndexSpace() const;
+	int32 GetNodeIndex(const FGuid& Guid) const;
+
+	// On instance with nodes created on demand, it creates the node if needed
+	UFlowNode* GetNodeByIndex(const int32 NodeIndex) const;
+
+	// Shared by the template and its instances, built on the game thread when the first instance is created
+	const FFlowGraphTopology& GetGraphTopology() const;
+
+	// True if all nodes are thread-safe, so signals sent to the Root Flow instance can be evaluated on a worker thread
+	bool CanEvaluateInParallel() const;
+
+	// Nodes starting the graph execution: default entry node and Custom Inputs
+	virtual void GatherEntryNodes(TArray<UFlowNode*>& OutEntryNodes) const;
+
+	// Nodes that can receive a signal, following connections from the entry nodes
+	// Nodes with Disabled signal mode are reachable, but signal never leaves them, so nodes connected only through them are unreachable
+	void GatherReachableNodes(TSet<FGuid>& OutReachableNodes) const;
 
 	template <class T>
 	T* GetNode(const FGuid& Guid) const
@@ -186,27 +391,31 @@ public:
 
 		if (FirstIteratedNode)
 		{
-			TSet<TObjectKey<UFlowNode>> IteratedNodes;
-			GetNodesInExecutionOrder_Recursive(FirstIteratedNode, IteratedNodes, OutNodes);
+			const FFlowGraphTopology& Topology = GetGraphTopology();
+			const int32 FirstNodeIndex = GetNodeIndex(FirstIteratedNode->GetGuid());
+
+			if (const TArray<int32>* ExecutionOrder = Topology.FindExecutionOrder(FirstNodeIndex))
+			{
+				GetNodesByIndex(*ExecutionOrder, OutNodes);
+			}
+			else
+			{
+				TArray<int32> NodeIndices;
+				Topology.GatherExecutionOrder(FirstNodeIndex, NodeIndices);
+				GetNodesByIndex(NodeIndices, OutNodes);
+			}
 		}
 	}
 
 protected:
 	template <class T>
-	void GetNodesInExecutionOrder_Recursive(UFlowNode* Node, TSet<TObjectKey<UFlowNode>>& IteratedNodes, TArray<T*>& OutNodes)
+	void GetNodesByIndex(const TArray<int32>& NodeIndices, TArray<T*>& OutNodes) const
 	{
-		IteratedNodes.Add(Node);
-
-		if (T* NodeOfRequiredType = Cast<T>(Node))
-		{
-			OutNodes.Emplace(NodeOfRequiredType);
-		}
-
-		for (UFlowNode* ConnectedNode : Node->GetConnectedNodes())
+		for (const int32 NodeIndex : NodeIndices)
 		{
-			if (ConnectedNode && !IteratedNodes.Contains(ConnectedNode))
+			if (T* NodeOfRequiredType = Cast<T>(GetNodeByIndex(NodeIndex)))
 			{
-				GetNodesInExecutionOrder_Recursive(ConnectedNode, IteratedNodes, OutNodes);
+				OutNodes.Emplace(NodeOfRequiredType);
 			}
 		}
 	}
@@ -218,6 +427,15 @@ public:
 	TArray<FName> GatherCustomInputNodeEventNames() const;
 	TArray<FName> GatherCustomOutputNodeEventNames() const;
 
+	// Events of Custom Input and Custom Output nodes, indexed once per template
+	const FFlowCustomEventIndex& GetCustomInputEvents() const;
+	const FFlowCustomEventIndex& GetCustomOutputEvents() const;
+
+private:
+	void IndexCustomEvents() const;
+
+public:
+
 #if WITH_EDITOR
 	const TArray<FName>& GetCustomInputs() const { return CustomInputs; }
 	const TArray<FName>& GetCustomOutputs() const { return CustomOutputs; }
@@ -259,6 +477,9 @@ public:
 	void SetInspectedInstance(const FName& NewInspectedInstanceName);
 	UFlowAsset* GetInspectedInstance() const { return InspectedInstance.IsValid() ? InspectedInstance.Get() : nullptr; }
 
+	// Installs debugging hooks on active instances, called after the inspected instance or breakpoints have changed
+	void RefreshInstanceObservers();
+
 	DECLARE_EVENT(UFlowAsset, FRefreshDebuggerEvent);
 
 	FRefreshDebuggerEvent& OnDebuggerRefresh() { return RefreshDebuggerEvent; }
@@ -295,6 +516,13 @@ protected:
 	UPROPERTY()
 	TSet<UFlowNode_CustomInput*> CustomInputNodes;
 
+	// Custom Input nodes grouped by the index of their event
+	TArray<TArray<UFlowNode_CustomInput*, TInlineAllocator<1>>> CustomInputNodesByEvent;
+
+	// Output pin of the SubGraph node owning this instance, for every Custom Output event
+	// Resolved once, while attaching instance to the SubGraph node
+	TArray<int32> CustomOutputPins;
+
 	UPROPERTY()
 	TSet<UFlowNode*> PreloadedNodes;
 
@@ -308,6 +536,12 @@ protected:
 
 	EFlowFinishPolicy FinishPolicy;
 
+	// False only on instance that creates nodes on demand and still hasn't created some of them
+	bool bAllNodesInstanced;
+
+	UFlowNode* CreateNodeInstance(UFlowNode* NodeTemplate);
+	void CreateRemainingNodeInstances();
+
 public:
 	virtual void InitializeInstance(const TWeakObjectPtr<UObject> InOwner, UFlowAsset* InTemplateAsset);
 	virtual void DeinitializeInstance();
@@ -339,6 +573,7 @@ public:
 
 	bool HasStartedFlow() const;
 	void TriggerCustomInput(const FName& EventName);
+	void TriggerCustomInputByIndex(const int32 EventIndex);
 
 	// Get Flow Asset instance created by the given SubGraph node
 	TWeakObjectPtr<UFlowAsset> GetFlowInstance(UFlowNode_SubGraph* SubGraphNode) const;
@@ -346,6 +581,11 @@ public:
 protected:
 	void TriggerCustomInput_FromSubGraph(UFlowNode_SubGraph* Node, const FName& EventName) const;
 	void TriggerCustomOutput(const FName& EventName);
+	void TriggerCustomOutputByIndex(const int32 EventIndex);
+
+	// Binds custom events of this instance to pins of the SubGraph node, both ways
+	void AttachToSubGraph(UFlowNode_SubGraph* SubGraphNode);
+	void DetachFromSubGraph();
 
 	void TriggerInput(const FGuid& NodeGuid, const FName& PinName);
 
@@ -371,6 +611,57 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Flow")
 	const TArray<UFlowNode*>& GetRecordedNodes() const { return RecordedNodes; }
 
+#if !UE_BUILD_SHIPPING
+private:
+	TSharedPtr<IFlowInstanceObserver> InstanceObserver;
+
+public:
+	// Inspected instance gets the observer recording pin activations for the graph editor
+	void SetInstanceObserver(const TSharedPtr<IFlowInstanceObserver>& NewObserver) { InstanceObserver = NewObserver; }
+	IFlowInstanceObserver* GetInstanceObserver() const { return InstanceObserver.Get(); }
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+// Timers
+
+protected:
+	// Scales time of timers scheduled by nodes of this instance and its Sub Graphs
+	UPROPERTY(SaveGame)
+	float TimeDilation;
+
+	UPROPERTY(SaveGame)
+	bool bTimersPaused;
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "Flow")
+	void SetTimeDilation(const float NewTimeDilation);
+
+	UFUNCTION(BlueprintCallable, Category = "Flow")
+	void SetTimersPaused(const bool bPaused);
+
+	// Time dilation of this instance, multiplied by time dilation of parent instances
+	UFUNCTION(BlueprintPure, Category = "Flow")
+	float GetTimeDilation() const;
+
+	// True, if timers of this instance or any of its parent instances are paused
+	UFUNCTION(BlueprintPure, Category = "Flow")
+	bool AreTimersPaused() const;
+
+//////////////////////////////////////////////////////////////////////////
+// Replicated state
+
+protected:
+	// SaveGame properties replicated to clients with the Root Flow state, if owning Flow Component has bReplicateRootFlowState enabled
+	UPROPERTY(EditAnywhere, Category = "Networking")
+	TArray<FName> ReplicatedSaveGameProperties;
+
+public:
+	const TArray<FName>& GetReplicatedSaveGameProperties() const { return ReplicatedSaveGameProperties; }
+
+	// Requests update of the replicated Root Flow state, call it after changing any of Replicated SaveGame Properties
+	UFUNCTION(BlueprintCallable, Category = "Flow")
+	void MarkReplicatedStateDirty() const;
+
 //////////////////////////////////////////////////////////////////////////
 // Expected Owner Class support (for use with CallOwnerFunction nodes)
 
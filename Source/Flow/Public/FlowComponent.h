@@ -5,6 +5,7 @@
 #include "Components/ActorComponent.h"
 #include "GameplayTagContainer.h"
 
+#include "FlowComponentReplication.h"
 #include "FlowSave.h"
 #include "FlowTypes.h"
 #include "FlowOwnerInterface.h"
@@ -13,31 +14,14 @@
 class UFlowAsset;
 class UFlowSubsystem;
 
-USTRUCT()
-struct FNotifyTagReplication
-{
-	GENERATED_BODY()
-
-	UPROPERTY()
-	FGameplayTag ActorTag;
-
-	UPROPERTY()
-	FGameplayTag NotifyTag;
-
-	FNotifyTagReplication() {}
-
-	FNotifyTagReplication(const FGameplayTag& InActorTag, const FGameplayTag& InNotifyTag)
-		: ActorTag(InActorTag)
-		, NotifyTag(InNotifyTag)
-	{
-	}
-};
-
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FFlowComponentTagsReplicated, class UFlowComponent*, FlowComponent, const FGameplayTagContainer&, CurrentTags);
 
 DECLARE_MULTICAST_DELEGATE_TwoParams(FFlowComponentNotify, class UFlowComponent*, const FGameplayTag&);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FFlowComponentDynamicNotify, class UFlowComponent*, FlowComponent, const FGameplayTag&, NotifyTag);
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FFlowComponentRootFlowStatesReplicated, class UFlowComponent*, FlowComponent);
+DECLARE_DELEGATE_OneParam(FNativeFlowComponentEvent, class UFlowComponent*);
+
 /**
 * Base component of Flow System - makes possible to communicate between Actor, Flow Subsystem and Flow Graphs
 */
@@ -47,7 +31,10 @@ class FLOW_API UFlowComponent : public UActorComponent, public IFlowOwnerInterfa
 	GENERATED_UCLASS_BODY()
 
 	friend class UFlowSubsystem;
+	friend struct FFlowIdentityTagList;
+	friend struct FFlowNotifyLog;
 	
+	virtual void PostInitProperties() override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	
 //////////////////////////////////////////////////////////////////////////
@@ -57,13 +44,9 @@ class FLOW_API UFlowComponent : public UActorComponent, public IFlowOwnerInterfa
 	FGameplayTagContainer IdentityTags;
 
 private:
-	// Used to replicate tags added during gameplay
-	UPROPERTY(ReplicatedUsing = OnRep_AddedIdentityTags)
-	FGameplayTagContainer AddedIdentityTags;
-
-	// Used to replicate tags removed during gameplay
-	UPROPERTY(ReplicatedUsing = OnRep_RemovedIdentityTags)
-	FGameplayTagContainer RemovedIdentityTags;
+	// Current Identity Tags of the server, replicated as a list of changes
+	UPROPERTY(Replicated)
+	FFlowIdentityTagList ReplicatedIdentityTags;
 
 public:
 	virtual void BeginPlay() override;
@@ -86,11 +69,12 @@ protected:
 	void UnregisterWithFlowSubsystem();
 	
 private:
-	UFUNCTION()
-	void OnRep_AddedIdentityTags();
+	void ReplicateIdentityTagsAdded(const FGameplayTagContainer& AddedTags);
+	void ReplicateIdentityTagsRemoved(const FGameplayTagContainer& RemovedTags);
 
-	UFUNCTION()
-	void OnRep_RemovedIdentityTags();
+	// Called on clients with tags added or removed on server
+	void OnReplicatedIdentityTagsAdded(const FGameplayTagContainer& AddedTags);
+	void OnReplicatedIdentityTagsRemoved(const FGameplayTagContainer& RemovedTags);
 
 public:
 	UPROPERTY(BlueprintAssignable, Category = "Flow")
@@ -105,12 +89,30 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Flow")
 	void LogError(FString Message, const EFlowOnScreenMessageType OnScreenMessageType = EFlowOnScreenMessageType::Permanent) const;
 
+//////////////////////////////////////////////////////////////////////////
+// Notify Tags replication
+
+private:
+	// Every notify sent on server, replicated to clients in the order of sending
+	UPROPERTY(Replicated)
+	FFlowNotifyLog NotifyLog;
+
+	bool ShouldReplicateNotifies() const;
+	void ReplicateNotify(const EFlowNotifyChannel Channel, const FGameplayTag& NotifyTag, const FGameplayTag& ActorTag = FGameplayTag());
+
+	// Called on clients with notifies sent by the server during a single frame
+	void OnNotifiesReplicated(const TConstArrayView<FFlowNotifyLogEntry> Entries);
+
+	// Client reports tags observed by its Flow Graphs, valid only on components owned by the client connection
+	UFUNCTION(Server, Reliable)
+	void ServerSetNotifyInterest(const FFlowNotifyInterest& Interest);
+
 //////////////////////////////////////////////////////////////////////////
 // Component sending Notify Tags to Flow Graph, or any other listener
 
 private:
 	// Stores only recently sent tags
-	UPROPERTY(ReplicatedUsing = OnRep_SentNotifyTags)
+	UPROPERTY()
 	FGameplayTagContainer RecentlySentNotifyTags;
 
 public:
@@ -127,8 +129,7 @@ public:
 	void BulkNotifyGraph(const FGameplayTagContainer NotifyTags, const EFlowNetMode NetMode = EFlowNetMode::Authority);
 
 private:
-	UFUNCTION()
-	void OnRep_SentNotifyTags();
+	void BroadcastSentNotifyTags();
 
 public:
 	FFlowComponentNotify OnNotifyFromComponent;
@@ -136,19 +137,9 @@ public:
 //////////////////////////////////////////////////////////////////////////
 // Component receiving Notify Tags from Flow Graph
 
-private:
-	// Stores only recently replicated tags
-	UPROPERTY(ReplicatedUsing = OnRep_NotifyTagsFromGraph)
-	FGameplayTagContainer NotifyTagsFromGraph;
-
 public:
 	virtual void NotifyFromGraph(const FGameplayTagContainer& NotifyTags, const EFlowNetMode NetMode = EFlowNetMode::Authority);
 
-private:
-	UFUNCTION()
-	void OnRep_NotifyTagsFromGraph();
-
-public:
 	// Receive notification from Flow graph or another Flow Component
 	UPROPERTY(BlueprintAssignable, Category = "Flow")
 	FFlowComponentDynamicNotify ReceiveNotify;
@@ -156,19 +147,13 @@ public:
 //////////////////////////////////////////////////////////////////////////
 // Sending Notify Tags between Flow components
 
-private:
-	// Stores only recently replicated tags
-	UPROPERTY(ReplicatedUsing = OnRep_NotifyTagsFromAnotherComponent)
-	TArray<FNotifyTagReplication> NotifyTagsFromAnotherComponent;
-
 public:
 	// Send notification to another actor containing Flow Component
 	UFUNCTION(BlueprintCallable, Category = "Flow")
 	virtual void NotifyActor(const FGameplayTag ActorTag, const FGameplayTag NotifyTag, const EFlowNetMode NetMode = EFlowNetMode::Authority);
 
 private:
-	UFUNCTION()
-	void OnRep_NotifyTagsFromAnotherComponent();
+	void BroadcastNotifyToActors(const FGameplayTag& ActorTag, const FGameplayTag& NotifyTag);
 
 //////////////////////////////////////////////////////////////////////////
 // Root Flow
@@ -208,6 +193,48 @@ public:
 	UFUNCTION(BlueprintPure, Category = "RootFlow", meta = (DeprecatedFunction, DeprecationMessage="Use GetRootInstances() instead."))
 	UFlowAsset* GetRootFlowInstance() const;
 
+//////////////////////////////////////////////////////////////////////////
+// Root Flow state replication
+
+public:
+	// If true, activation state of Root Flows started by this component is replicated to clients, i.e. to display quest progress
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "RootFlow")
+	bool bReplicateRootFlowState;
+
+private:
+	UPROPERTY(ReplicatedUsing = OnRep_RootFlowStates)
+	TArray<FFlowRootFlowState> RootFlowStates;
+
+	FTimerHandle RootFlowStatesUpdateHandle;
+
+	UFUNCTION()
+	void OnRep_RootFlowStates();
+
+	void UpdateRootFlowStates();
+
+public:
+	// UFlowAsset-only access, changes made during the frame are replicated as a single update
+	void MarkRootFlowStateDirty();
+
+	UFUNCTION(BlueprintPure, Category = "RootFlow")
+	const TArray<FFlowRootFlowState>& GetRootFlowStates() const { return RootFlowStates; }
+
+	const FFlowRootFlowState* FindRootFlowState(const UFlowAsset* TemplateAsset) const;
+
+	UFUNCTION(BlueprintPure, Category = "RootFlow")
+	bool IsRootFlowNodeActive(const UFlowAsset* TemplateAsset, const FGuid& NodeGuid) const;
+
+	UFUNCTION(BlueprintPure, Category = "RootFlow")
+	bool IsRootFlowNodeCompleted(const UFlowAsset* TemplateAsset, const FGuid& NodeGuid) const;
+
+	UPROPERTY(BlueprintAssignable, Category = "RootFlow")
+	FFlowComponentRootFlowStatesReplicated OnRootFlowStatesReplicated;
+
+#if WITH_EDITOR
+	// Called on clients after receiving Root Flow states, lets the editor debugger display nodes of assets not instanced in this process
+	static FNativeFlowComponentEvent OnRootFlowStatesReplicatedNative;
+#endif
+
 //////////////////////////////////////////////////////////////////////////
 // UFlowComponent overrideable events
 
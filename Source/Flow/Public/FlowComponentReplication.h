@@ -0,0 +1,264 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "GameplayTagContainer.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "FlowComponentReplication.generated.h"
+
+class UFlowAsset;
+class UFlowComponent;
+
+USTRUCT()
+struct FFlowIdentityTagItem : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FGameplayTag Tag;
+
+	FFlowIdentityTagItem() {}
+
+	explicit FFlowIdentityTagItem(const FGameplayTag& InTag)
+		: Tag(InTag)
+	{
+	}
+};
+
+/**
+ * Replicates the current set of Identity Tags, sending only tags added or removed since the last update
+ */
+USTRUCT()
+struct FFlowIdentityTagList : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	friend class UFlowComponent;
+
+	bool AddTag(const FGameplayTag& Tag);
+	bool RemoveTag(const FGameplayTag& Tag);
+
+	// FFastArraySerializer
+	void PreReplicatedRemove(const TArrayView<int32>& RemovedIndices, int32 FinalSize);
+	void PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 FinalSize);
+	// --
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms);
+
+private:
+	UPROPERTY()
+	TArray<FFlowIdentityTagItem> Items;
+
+	// Component owning this list, assigned in UFlowComponent::PostInitProperties
+	UFlowComponent* Owner = nullptr;
+
+	// Client only, tags not present on server are removed after receiving the list for the first time
+	bool bReceivedInitialState = false;
+};
+
+template <>
+struct TStructOpsTypeTraits<FFlowIdentityTagList> : public TStructOpsTypeTraitsBase2<FFlowIdentityTagList>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
+UENUM()
+enum class EFlowNotifyChannel : uint8
+{
+	FromComponent,	// UFlowComponent::NotifyGraph, received by Flow Graphs
+	FromGraph,		// UFlowComponent::NotifyFromGraph, received by the component itself
+	ToActor			// UFlowComponent::NotifyActor, received by components identified by the Actor Tag
+};
+
+/**
+ * Identity and Notify Tags observed by Flow Graphs running on a client
+ * Server uses it to skip replicating notifies that no client-side graph would receive
+ */
+USTRUCT()
+struct FFlowNotifyInterest
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FGameplayTagContainer IdentityTags;
+
+	UPROPERTY()
+	FGameplayTagContainer NotifyTags;
+
+	// Client observes notifies with any Notify Tag
+	UPROPERTY()
+	bool bAnyNotifyTag = false;
+
+	bool IsInterestedIn(const FGameplayTagContainer& ComponentIdentityTags, const FGameplayTag& NotifyTag) const
+	{
+		return (bAnyNotifyTag || NotifyTags.HasTagExact(NotifyTag)) && ComponentIdentityTags.HasAnyExact(IdentityTags);
+	}
+
+	bool operator==(const FFlowNotifyInterest& Other) const
+	{
+		return bAnyNotifyTag == Other.bAnyNotifyTag && IdentityTags == Other.IdentityTags && NotifyTags == Other.NotifyTags;
+	}
+
+	bool operator!=(const FFlowNotifyInterest& Other) const
+	{
+		return !(*this == Other);
+	}
+};
+
+USTRUCT()
+struct FFlowNotifyLogEntry
+{
+	GENERATED_BODY()
+
+	// Increasing per component, clients dispatch entries by id as batches can be replicated again with different entries
+	UPROPERTY()
+	uint32 Id = 0;
+
+	UPROPERTY()
+	EFlowNotifyChannel Channel = EFlowNotifyChannel::FromComponent;
+
+	UPROPERTY()
+	FGameplayTag NotifyTag;
+
+	// Used only by the ToActor channel
+	UPROPERTY()
+	FGameplayTag ActorTag;
+
+	FFlowNotifyLogEntry() {}
+
+	FFlowNotifyLogEntry(const uint32 InId, const EFlowNotifyChannel InChannel, const FGameplayTag& InNotifyTag, const FGameplayTag& InActorTag)
+		: Id(InId)
+		, Channel(InChannel)
+		, NotifyTag(InNotifyTag)
+		, ActorTag(InActorTag)
+	{
+	}
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+/**
+ * All notifies sent by the component during a single frame, while it had the same Identity Tags
+ */
+USTRUCT()
+struct FFlowNotifyLogItem : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FFlowNotifyLogEntry> Entries;
+
+	// Server only, frame and platform time when the batch has been created
+	uint64 Frame = 0;
+	double CreationTime = 0.0;
+
+	// Server only, Identity Tags of the component when notifies were recorded, used to filter entries by client interest
+	FGameplayTagContainer IdentityTags;
+
+	// Skips entries the receiving connection isn't interested in
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FFlowNotifyLogItem> : public TStructOpsTypeTraitsBase2<FFlowNotifyLogItem>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
+
+/**
+ * Replicates every notify sent through the Flow Component exactly once, in the order of sending
+ * - notifies are batched per frame, batches are kept for a short time to let them reach all clients
+ * - delivery is best-effort: client that hasn't received an update within UFlowSettings::NotifyLogRetentionTime misses expired notifies
+ * - notifies sent before the client joined the game aren't replicated to it
+ * - gameplay tags use their net index, if Fast Replication is enabled in Gameplay Tags settings
+ * - optionally, notifies sent to Flow Graphs are filtered by the interest reported by the receiving client
+ */
+USTRUCT()
+struct FFlowNotifyLog : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	friend class UFlowComponent;
+
+	void AddNotify(const EFlowNotifyChannel Channel, const FGameplayTag& NotifyTag, const FGameplayTag& ActorTag = FGameplayTag());
+
+	// FFastArraySerializer
+	void PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 FinalSize);
+	void PostReplicatedChange(const TArrayView<int32>& ChangedIndices, int32 FinalSize);
+	// --
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms);
+
+private:
+	void RemoveExpiredItems(const double CurrentTime);
+	void DispatchPendingEntries();
+
+	UPROPERTY()
+	TArray<FFlowNotifyLogItem> Items;
+
+	// Component owning this log, assigned in UFlowComponent::PostInitProperties
+	UFlowComponent* Owner = nullptr;
+
+	// Server only, id of the last recorded entry
+	uint32 LastEntryId = 0;
+
+	// Client only, entries with this id or lower have been already dispatched
+	uint32 LastDispatchedId = 0;
+};
+
+template <>
+struct TStructOpsTypeTraits<FFlowNotifyLog> : public TStructOpsTypeTraitsBase2<FFlowNotifyLog>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
+/**
+ * Activation state of the Root Flow instance, replicated to clients i.e. to display quest progress
+ * - node sets are bitsets over UFlowAsset::GetNodeIndexSpace, property replication sends only changed words
+ * - includes SaveGame properties listed in UFlowAsset::ReplicatedSaveGameProperties
+ */
+USTRUCT(BlueprintType)
+struct FLOW_API FFlowRootFlowState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Flow")
+	TObjectPtr<UFlowAsset> TemplateAsset = nullptr;
+
+	// Distinguishes instances of the same template
+	UPROPERTY(BlueprintReadOnly, Category = "Flow")
+	FName InstanceName;
+
+private:
+	UPROPERTY()
+	TArray<uint32> ActiveNodes;
+
+	// Nodes that finished their work, completed or aborted
+	UPROPERTY()
+	TArray<uint32> CompletedNodes;
+
+	UPROPERTY()
+	TArray<uint8> SaveGameProperties;
+
+public:
+	// Server only, returns true if state has changed
+	bool Update(const UFlowAsset& Instance);
+
+	bool IsNodeActive(const FGuid& NodeGuid) const;
+	bool IsNodeCompleted(const FGuid& NodeGuid) const;
+
+	// Writes replicated SaveGame property values to the object of template class, i.e. to display them in UI
+	void ApplySaveGameProperties(UFlowAsset& Target) const;
+
+private:
+	bool IsNodeSet(const TArray<uint32>& NodeBits, const FGuid& NodeGuid) const;
+};
@@ -16,6 +16,9 @@ class FLOW_API UFlowOwnerFunctionParams : public UObject
 public:
 	UFlowOwnerFunctionParams();
 
+	// Caches class-level data used on every execution, called once per node instance
+	void InitializeInstance();
+
 	void PreExecute(UFlowNode_CallOwnerFunction& InSourceNode, const FName& InputPinName);
 	void PostExecute();
 
@@ -65,6 +68,10 @@ protected:
 	UPROPERTY(Transient, BlueprintReadOnly, Category = "FlowOwnerFunction")
 	FName ExecutedInputPinName;
 
+	// Skipping calls to empty blueprint events, resolved in InitializeInstance()
+	uint8 bImplementsPreExecute : 1;
+	uint8 bImplementsPostExecute : 1;
+
 #if WITH_EDITORONLY_DATA
 	// Input pin names for this function
 	UPROPERTY(EditDefaultsOnly, Category = "FlowOwnerFunction")
@@ -9,6 +9,14 @@
 class UFlowOwnerFunctionParams;
 class IFlowOwnerInterface;
 
+// Signature of typed C++ bindings for Flow Owner Functions, called without going through reflection
+typedef FName (*FFlowOwnerNativeFunction)(UObject& FlowOwnerObject, UFlowOwnerFunctionParams& Params);
+
+// Registers member function as the native binding of the UFUNCTION with the same name
+//  i.e. FLOW_REGISTER_OWNER_FUNCTION(AMyOwnerActor, UMyOwnerFunctionParams, OpenDoor) called from module startup
+#define FLOW_REGISTER_OWNER_FUNCTION(OwnerClass, ParamsClass, FunctionName) \
+	FFlowOwnerFunctionRef::RegisterNativeFunction<OwnerClass, ParamsClass, &OwnerClass::FunctionName>(GET_FUNCTION_NAME_CHECKED(OwnerClass, FunctionName))
+
 // Similar to FAnimNodeFunctionRef, providing a FName-based function binding
 //  that is resolved at runtime
 USTRUCT(BlueprintType)
@@ -23,6 +31,7 @@ struct FFlowOwnerFunctionRef
 public:
 
 	// Resolves the function and returns the UFunction
+	//  (returns the cached function, if it has been already resolved for this class)
 	UFunction* TryResolveFunction(const UClass& InClass);
 
 	// Returns a the resolved function
@@ -32,22 +41,55 @@ public:
 	// Call the function and return the Output Pin Name result
 	FName CallFunction(IFlowOwnerInterface& InFlowOwnerInterface, UFlowOwnerFunctionParams& InParams) const;
 
+	// Call the function and return the Output Pin Name result, validated against precomputed output names
+	FName CallFunction(UObject& FlowOwnerObject, UFlowOwnerFunctionParams& InParams, const TSet<FName>& ValidOutputNames) const;
+
 	// Accessors
 	FName GetFunctionName() const { return FunctionName; }
 	bool IsConfigured() const { return !FunctionName.IsNone(); }
 	bool IsResolved() const { return ::IsValid(Function); }
+	bool HasNativeBinding() const { return NativeFunction != nullptr; }
+
+	// Registers typed C++ binding for the UFUNCTION of given name declared in the OwnerT class
+	//  Binding is used only if the function resolved on the owner is this native UFUNCTION, i.e. not overridden by blueprint
+	template <class OwnerT, class ParamsT, FName (OwnerT::*Method)(ParamsT*)>
+	static void RegisterNativeFunction(const FName& InFunctionName)
+	{
+		static_assert(TPointerIsConvertibleFromTo<ParamsT, const UFlowOwnerFunctionParams>::Value, "'ParamsT' template parameter to RegisterNativeFunction must be derived from UFlowOwnerFunctionParams");
+
+		RegisterNativeFunction(OwnerT::StaticClass(), InFunctionName, [](UObject& FlowOwnerObject, UFlowOwnerFunctionParams& Params) -> FName
+		{
+			return (static_cast<OwnerT&>(FlowOwnerObject).*Method)(static_cast<ParamsT*>(&Params));
+		});
+	}
+
+	static void RegisterNativeFunction(const UClass* OwnerClass, const FName& InFunctionName, FFlowOwnerNativeFunction InNativeFunction);
+	static void UnregisterNativeFunction(const UClass* OwnerClass, const FName& InFunctionName);
 
 protected:
+	FName InvokeFunction(UObject& FlowOwnerObject, UFlowOwnerFunctionParams& InParams) const;
+	FName ValidateOutputName(const FName& OutputPinName, const TArray<FName>& OutputNames) const;
+
+	static TMap<TPair<const UClass*, FName>, FFlowOwnerNativeFunction>& GetNativeFunctions();
 
 	// The name of the function to call
 	UPROPERTY(VisibleAnywhere, Category = "FlowOwnerFunction")
-	FName FunctionName = NAME_None;	
+	FName FunctionName = NAME_None;
 
 	// The function to call
 	//  (resolved by looking for a function named FunctionName on the ExpectedOwnerClass)
 	UPROPERTY(Transient)
 	TObjectPtr<UFunction> Function = nullptr;
 
+	// Class the Function has been resolved for
+	TWeakObjectPtr<const UClass> ResolvedClass;
+
+	// Typed C++ binding registered for the resolved function, if any
+	FFlowOwnerNativeFunction NativeFunction = nullptr;
+
+	// Native function can be called through its thunk, without the overhead of ProcessEvent
+	bool bInvokeNativeThunk = false;
+
 #if WITH_EDITORONLY_DATA
 	UPROPERTY(VisibleAnywhere, Category = "FlowOwnerFunction", meta = (DisplayName = "Function Parameters Class"))
 	TSubclassOf<UFlowOwnerFunctionParams> ParamsClass;
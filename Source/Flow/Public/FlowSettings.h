@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/DeveloperSettings.h"
+#include "GameplayTagContainer.h"
 #include "Templates/SubclassOf.h"
 #include "UObject/SoftObjectPath.h"
 #include "FlowSettings.generated.h"
@@ -24,9 +25,38 @@ class FLOW_API UFlowSettings : public UDeveloperSettings
 	UPROPERTY(Config, EditAnywhere, Category = "Networking")
 	bool bCreateFlowSubsystemOnClients;
 
+	// How long notifies sent by Flow Component are kept for replication, in seconds
+	// Delivery is best-effort, notify won't reach a client that hasn't received any update from the actor during this time
+	UPROPERTY(Config, EditAnywhere, Category = "Networking", meta = (ClampMin = 0.1))
+	float NotifyLogRetentionTime;
+
+	// If enabled, clients report Identity and Notify Tags observed by their Flow Graphs
+	// and server replicates Notify Graph calls only to clients observing them
+	// Retroactive checks on clients won't see notifies sent before client started observing them
+	UPROPERTY(Config, EditAnywhere, Category = "Networking")
+	bool bFilterNotifiesByClientInterest;
+
+	// Server accepts client interest only in Notify Tags matching these tags, empty container accepts any Notify Tag
+	UPROPERTY(Config, EditAnywhere, Category = "Networking", meta = (EditCondition = "bFilterNotifiesByClientInterest"))
+	FGameplayTagContainer NotifyInterestTagRoots;
+
+	// Server ignores client interest listing more Identity and Notify Tags than this
+	UPROPERTY(Config, EditAnywhere, Category = "Networking", meta = (ClampMin = 1, EditCondition = "bFilterNotifiesByClientInterest"))
+	int32 MaxNotifyInterestTags;
+
 	UPROPERTY(Config, EditAnywhere, Category = "SaveSystem")
 	bool bWarnAboutMissingIdentityTags;
 
+	// If enabled, signals queued for Root Flows made only of thread-safe nodes are evaluated on worker threads
+	// Commands are then executed in the order of submission per Flow Asset instance, not per submitting thread
+	UPROPERTY(Config, EditAnywhere, Category = "Flow")
+	bool bEvaluateRootFlowsInParallel;
+
+	// If enabled, cooking removes nodes unreachable from the graph entry points: default entry node and Custom Inputs
+	// Stripped nodes are excluded from the cooked package, so they can't be found by Guid in the cooked game
+	UPROPERTY(Config, EditAnywhere, Category = "Flow")
+	bool bStripUnreachableNodesOnCook;
+
 	// If enabled, runtime logs will be added when a flow node signal mode is set to Disabled
 	UPROPERTY(Config, EditAnywhere, Category = "Flow")
 	bool bLogOnSignalDisabled;
@@ -44,6 +74,11 @@ class FLOW_API UFlowSettings : public UDeveloperSettings
 	UPROPERTY(EditAnywhere, Config, Category = "Nodes", meta = (MustImplement = "/Script/Flow.FlowOwnerInterface"))
 	FSoftClassPath DefaultExpectedOwnerClass;
 
+	// How many idle Level Sequence Actors can be kept by Flow Subsystem per sequence, to be reused by Play Level Sequence nodes
+	// Set it to zero to destroy Level Sequence Actors after playback
+	UPROPERTY(EditAnywhere, Config, Category = "Nodes", meta = (ClampMin = 0))
+	int32 MaxPooledLevelSequenceActors;
+
 public:
 	UClass* GetDefaultExpectedOwnerClass() const;
 
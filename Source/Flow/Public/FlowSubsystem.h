@@ -4,13 +4,22 @@
 
 #include "GameFramework/Actor.h"
 #include "GameplayTagContainer.h"
+#include "Containers/Queue.h"
+#include "LevelSequencePlayer.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
 
 #include "FlowComponent.h"
+#include "FlowTimerWheel.h"
 #include "FlowSubsystem.generated.h"
 
+class AFlowLevelSequenceActor;
 class UFlowAsset;
+class UFlowLevelSequencePlayer;
 class UFlowNode_SubGraph;
+class AGameModeBase;
+class APlayerController;
+class UNetConnection;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FSimpleFlowEvent);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSimpleFlowComponentEvent, UFlowComponent*, Component);
@@ -18,14 +27,53 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FTaggedFlowComponentEvent, UFlowCom
 
 DECLARE_DELEGATE_OneParam(FNativeFlowAssetEvent, class UFlowAsset*);
 
+/* Idle Level Sequence Actors playing the same sequence */
+USTRUCT()
+struct FFlowLevelSequencePool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AFlowLevelSequenceActor>> Actors;
+};
+
+/* Operation submitted from any thread, executed on the game thread by the Flow Subsystem */
+struct FFlowSubsystemCommand
+{
+	enum class EType : uint8
+	{
+		NotifyGraph,
+		AddIdentityTag,
+		RemoveIdentityTag,
+		TriggerCustomInput,
+		StartRootFlow
+	};
+
+	EType Type = EType::NotifyGraph;
+
+	/* Flow Component, Flow Asset instance or Root Flow owner, depending on the command type */
+	TWeakObjectPtr<UObject> Target;
+
+	/* Only StartRootFlow */
+	TWeakObjectPtr<UFlowAsset> FlowAsset;
+
+	FGameplayTag Tag;
+	FName EventName;
+	EFlowNetMode NetMode = EFlowNetMode::Authority;
+	bool bAllowMultipleInstances = true;
+};
+
 /**
  * Flow Subsystem
  * - manages lifetime of Flow Graphs
  * - connects Flow Graphs with actors containing the Flow Component
+ * - runs timers of all Flow Graphs
+ * - executes operations submitted from other threads, optionally evaluating thread-safe Root Flows in parallel
+ * - pools Level Sequence Actors used by Flow Graphs
  * - convenient base for project-specific systems
  */
 UCLASS()
-class FLOW_API UFlowSubsystem : public UGameInstanceSubsystem
+class FLOW_API UFlowSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
 {
 	GENERATED_BODY()
 
@@ -116,6 +164,139 @@ public:
 
 	virtual UWorld* GetWorld() const override;
 
+//////////////////////////////////////////////////////////////////////////
+// Timers
+
+protected:
+	/* Timers scheduled by all Flow Node instances, processed once per tick */
+	FFlowTimerWheel FlowTimers;
+
+public:
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+	virtual UWorld* GetTickableGameObjectWorld() const override;
+	// --
+
+	FFlowTimerWheel& GetFlowTimers() { return FlowTimers; }
+	const FFlowTimerWheel& GetFlowTimers() const { return FlowTimers; }
+
+//////////////////////////////////////////////////////////////////////////
+// Thread-safe commands
+
+protected:
+	/* Operations submitted from any thread, executed at the beginning of the next tick
+	 * Lock-free, commands submitted by the same thread are executed in the order of submission */
+	TQueue<FFlowSubsystemCommand, EQueueMode::Mpsc> PendingCommands;
+
+public:
+	/* Thread-safe variants of game thread operations, executed at the beginning of the next Flow Subsystem tick
+	 * Objects are held by weak pointers, commands targeting destroyed objects are dropped */
+	void EnqueueNotifyGraph(UFlowComponent* Component, const FGameplayTag& NotifyTag, const EFlowNetMode NetMode = EFlowNetMode::Authority);
+	void EnqueueAddIdentityTag(UFlowComponent* Component, const FGameplayTag& Tag, const EFlowNetMode NetMode = EFlowNetMode::Authority);
+	void EnqueueRemoveIdentityTag(UFlowComponent* Component, const FGameplayTag& Tag, const EFlowNetMode NetMode = EFlowNetMode::Authority);
+	void EnqueueTriggerCustomInput(UFlowAsset* FlowInstance, const FName& EventName);
+	void EnqueueStartRootFlow(UObject* Owner, UFlowAsset* FlowAsset, const bool bAllowMultipleInstances = true);
+
+	void EnqueueCommand(FFlowSubsystemCommand&& Command);
+
+protected:
+	void ExecutePendingCommands();
+	virtual void ExecuteCommand(const FFlowSubsystemCommand& Command);
+
+//////////////////////////////////////////////////////////////////////////
+// Parallel evaluation
+
+protected:
+	/* Guards Flow timers while thread-safe Root Flows are evaluated on worker threads */
+	FCriticalSection FlowTimersLock;
+
+public:
+	/* True while evaluating thread-safe Root Flows, see UFlowSettings::bEvaluateRootFlowsInParallel */
+	static bool IsInParallelEvaluation();
+
+	/* Executes work immediately, or after all instances have been evaluated if called during the parallel evaluation */
+	static void RunOnGameThread(TUniqueFunction<void()>&& Work);
+
+	FCriticalSection& GetFlowTimersLock() { return FlowTimersLock; }
+
+protected:
+	/* Only signals sent to Root Flows made of thread-safe nodes can be evaluated in parallel */
+	virtual bool CanExecuteInParallel(const FFlowSubsystemCommand& Command) const;
+	void ExecuteCommandsInParallel(TArray<FFlowSubsystemCommand>& Commands);
+
+//////////////////////////////////////////////////////////////////////////
+// Notify interest
+
+protected:
+	/* Client only, Identity and Notify Tags observed by active Flow Nodes, with number of observers */
+	TMap<FGameplayTag, int32> ObservedIdentityTags;
+	TMap<FGameplayTag, int32> ObservedNotifyTags;
+	int32 AnyNotifyTagObservers = 0;
+
+	/* Client only, observed tags changed and need to be sent to server on the next tick */
+	bool bNotifyInterestDirty = false;
+
+	/* Client only, component owned by the local player, used to call server RPC */
+	TWeakObjectPtr<UFlowComponent> NotifyInterestSender;
+
+	/* Server only, interest reported by clients, connections without an entry receive all notifies */
+	TMap<TWeakObjectPtr<const UNetConnection>, FFlowNotifyInterest> ConnectionNotifyInterests;
+
+	/* Server only, platform time when remote players joined, notifies sent earlier aren't replicated to them */
+	TMap<TWeakObjectPtr<const UNetConnection>, double> ConnectionJoinTimes;
+	FDelegateHandle PostLoginHandle;
+
+	void OnPostLogin(AGameModeBase* GameMode, APlayerController* NewPlayer);
+
+public:
+	/* Registers tags observed by the client-side Flow Node, see UFlowSettings::bFilterNotifiesByClientInterest */
+	virtual void AddNotifyInterest(const FGameplayTagContainer& IdentityTags, const FGameplayTagContainer& NotifyTags);
+	virtual void RemoveNotifyInterest(const FGameplayTagContainer& IdentityTags, const FGameplayTagContainer& NotifyTags);
+
+	void SetConnectionNotifyInterest(const UNetConnection* Connection, const FFlowNotifyInterest& Interest);
+	const FFlowNotifyInterest* FindConnectionNotifyInterest(const UNetConnection* Connection) const;
+
+	/* Returns zero for connections that joined before the subsystem was created, i.e. travelling with the server */
+	double GetConnectionJoinTime(const UNetConnection* Connection) const;
+
+protected:
+	bool ShouldReportNotifyInterest() const;
+	void SendNotifyInterest();
+
+//////////////////////////////////////////////////////////////////////////
+// Level Sequence pool
+
+protected:
+	/* Idle Level Sequence Actors, reused instead of spawning a new actor for every playback */
+	UPROPERTY()
+	TMap<TObjectPtr<ULevelSequence>, FFlowLevelSequencePool> LevelSequencePool;
+
+public:
+	/* Returns player of the idle pooled actor matching given settings, or spawns a new actor */
+	virtual UFlowLevelSequencePlayer* AcquireLevelSequencePlayer(ULevelSequence* LevelSequence, const FMovieSceneSequencePlaybackSettings& Settings, const FLevelSequenceCameraSettings& CameraSettings,
+		AActor* TransformOriginActor, const bool bReplicates, const bool bAlwaysRelevant);
+
+	/* Stops the player and puts its actor back to the pool, or destroys actor if pool is full */
+	virtual void ReleaseLevelSequencePlayer(UFlowLevelSequencePlayer* Player);
+
+	/* Spawns idle Level Sequence Actors in advance, so playing this sequence won't need to spawn actors */
+	UFUNCTION(BlueprintCallable, Category = "FlowSubsystem")
+	virtual void PrewarmLevelSequencePlayers(ULevelSequence* LevelSequence, const int32 Count, const FLevelSequenceCameraSettings CameraSettings, const bool bReplicates = false, const bool bAlwaysRelevant = false);
+
+	/* Destroys all idle Level Sequence Actors */
+	UFUNCTION(BlueprintCallable, Category = "FlowSubsystem")
+	virtual void ClearLevelSequencePool();
+
+//////////////////////////////////////////////////////////////////////////
+// Memory report
+
+	/* Lists memory used by Flow Graph instances per template asset, called by the Flow.MemReport console command
+	 * Add +Cmd="Flow.MemReport" to [MemReportCommands] section of DefaultEngine.ini to include it in memreport */
+	virtual void DumpMemoryReport(FOutputDevice& Ar) const;
+
 //////////////////////////////////////////////////////////////////////////
 // SaveGame support
 
@@ -430,3 +611,28 @@ private:
 	void FindComponents(const FGameplayTag& Tag, const bool bExactMatch, TArray<TWeakObjectPtr<UFlowComponent>>& OutComponents) const;
 	void FindComponents(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch, TSet<TWeakObjectPtr<UFlowComponent>>& OutComponents) const;
 };
+
+/* Locks Flow timers only during the parallel evaluation, game thread has exclusive access to them otherwise */
+class FLOW_API FFlowTimersScopeLock
+{
+public:
+	explicit FFlowTimersScopeLock(UFlowSubsystem& FlowSubsystem)
+		: Lock(UFlowSubsystem::IsInParallelEvaluation() ? &FlowSubsystem.GetFlowTimersLock() : nullptr)
+	{
+		if (Lock)
+		{
+			Lock->Lock();
+		}
+	}
+
+	~FFlowTimersScopeLock()
+	{
+		if (Lock)
+		{
+			Lock->Unlock();
+		}
+	}
+
+private:
+	FCriticalSection* Lock;
+};
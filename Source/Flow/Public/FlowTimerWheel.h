@@ -0,0 +1,141 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Containers/SparseArray.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UFlowAsset;
+class UFlowNode;
+
+/**
+ * Identifies a timer scheduled in the Flow Timer Wheel
+ */
+struct FLOW_API FFlowTimerHandle
+{
+	FFlowTimerHandle()
+		: Index(INDEX_NONE)
+		, Serial(0)
+	{
+	}
+
+	bool IsValid() const { return Serial != 0; }
+	void Invalidate() { Serial = 0; }
+
+	FORCEINLINE bool operator==(const FFlowTimerHandle& Other) const
+	{
+		return Index == Other.Index && Serial == Other.Serial;
+	}
+
+	FORCEINLINE bool operator!=(const FFlowTimerHandle& Other) const
+	{
+		return !(*this == Other);
+	}
+
+	friend uint32 GetTypeHash(const FFlowTimerHandle& Handle)
+	{
+		return HashCombine(GetTypeHash(Handle.Index), GetTypeHash(Handle.Serial));
+	}
+
+private:
+	friend class FFlowTimerWheel;
+
+	int32 Index;
+	uint32 Serial;
+};
+
+/**
+ * Hierarchical timing wheel shared by all timer-style nodes of the Flow Subsystem
+ * - timers are bucketed by expiry tick, so the cost of advancing time depends on number of expired timers, not on the number of scheduled timers
+ * - expired timers are collected and dispatched as a single batch per tick
+ * - every timer belongs to the Flow Asset instance of its node, which allows pausing and dilating time per instance
+ */
+class FLOW_API FFlowTimerWheel
+{
+public:
+	// Duration of a single wheel tick, in seconds
+	static constexpr double TickResolution = 0.001;
+
+	static constexpr int32 SlotBits = 6;
+	static constexpr int32 NumSlots = 1 << SlotBits;
+	static constexpr int32 SlotMask = NumSlots - 1;
+	static constexpr int32 NumLevels = 4;
+
+	FFlowTimerWheel();
+
+	/**
+	 * Schedules a callback on the given node
+	 * @param Rate Time in seconds of the owning Flow Asset instance, i.e. affected by its time dilation
+	 * @param bLoop If true, timer will be rescheduled after every call
+	 * @param FirstDelay Time until the first call, Rate will be used if this value is negative
+	 */
+	FFlowTimerHandle SetTimer(UFlowNode* Node, const float Rate, const bool bLoop, const float FirstDelay = -1.0f);
+	void ClearTimer(FFlowTimerHandle& Handle);
+	void ClearAllTimers();
+
+	bool IsTimerActive(const FFlowTimerHandle& Handle) const;
+	float GetTimerRemaining(const FFlowTimerHandle& Handle) const;
+	float GetTimerElapsed(const FFlowTimerHandle& Handle) const;
+
+	// Applies new time dilation or pause state of the Flow Asset instance to all its timers
+	void RefreshInstanceTimers(const UFlowAsset* FlowInstance);
+
+	// Advances wheel time and calls all timers expired within this period
+	void Tick(const float DeltaTime);
+
+	int32 Num() const { return Timers.Num(); }
+	bool HasPendingTimers() const { return Timers.Num() > 0; }
+
+private:
+	struct FTimer
+	{
+		TWeakObjectPtr<UFlowNode> Node;
+		TWeakObjectPtr<UFlowAsset> FlowInstance;
+
+		uint64 ExpireTick;
+		float Rate;
+
+		// Time dilation of the Flow Asset instance at the moment of placing timer in the wheel
+		float ScheduledDilation;
+
+		// Remaining instance time, valid only while timer is paused
+		float PausedRemaining;
+
+		uint32 Serial;
+
+		// Incremented every time timer is placed in the wheel, older slot entries are ignored
+		uint32 Insertion;
+
+		uint8 bLoop : 1;
+		uint8 bPaused : 1;
+	};
+
+	struct FSlotEntry
+	{
+		int32 Index;
+		uint32 Insertion;
+	};
+
+	TSparseArray<FTimer> Timers;
+	TArray<FSlotEntry> Wheel[NumLevels][NumSlots];
+
+	// Reused between ticks to avoid allocations
+	TArray<FFlowTimerHandle> ExpiredTimers;
+
+	uint64 CurrentTick;
+	double AccumulatedTime;
+
+	uint32 SerialCounter;
+	uint32 InsertionCounter;
+
+	const FTimer* FindTimer(const FFlowTimerHandle& Handle) const;
+	float GetRemaining(const FTimer& Timer) const;
+
+	static float GetTimeDilation(const FTimer& Timer);
+	static bool IsInstancePaused(const FTimer& Timer);
+
+	void Schedule(const int32 Index, const float InstanceDelay, const uint64 BaseTick);
+	void Insert(const int32 Index);
+	void Cascade(const int32 Level, const int32 SlotIndex);
+	void CollectExpired(TArray<FSlotEntry>& Slot);
+};
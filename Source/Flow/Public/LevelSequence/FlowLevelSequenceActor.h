@@ -25,6 +25,9 @@ public:
 	void SetPlaybackSettings(FMovieSceneSequencePlaybackSettings NewPlaybackSettings);
 	void SetReplicatedLevelSequenceAsset(ULevelSequence* Asset);
 
+	// Settings applied while spawning the actor, pooled actor can be reused only if these match
+	bool CanBeReusedFor(const FLevelSequenceCameraSettings& InCameraSettings, const bool bInReplicates, const bool bInAlwaysRelevant) const;
+
 protected:
 	UFUNCTION()
 	void OnRep_ReplicatedLevelSequenceAsset();
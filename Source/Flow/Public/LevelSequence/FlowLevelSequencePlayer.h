@@ -5,7 +5,9 @@
 #include "LevelSequencePlayer.h"
 #include "FlowLevelSequencePlayer.generated.h"
 
+class AFlowLevelSequenceActor;
 class UFlowNode;
+class UFlowNode_PlayLevelSequence;
 
 /**
  * Custom ULevelSequencePlayer allows for binding Flow Nodes to Level Sequence events
@@ -20,6 +22,10 @@ private:
 	UPROPERTY()
 	UFlowNode* FlowEventReceiver;
 
+	// FlowEventReceiver cast once, so Flow Track doesn't need to cast it on every event
+	UPROPERTY()
+	UFlowNode_PlayLevelSequence* PlayLevelSequenceNode;
+
 public:
 	// variant of ULevelSequencePlayer::CreateLevelSequencePlayer
 	static UFlowLevelSequencePlayer* CreateFlowLevelSequencePlayer(
@@ -32,7 +38,12 @@ public:
 		const bool bAlwaysRelevant,
 		ALevelSequenceActor*& OutActor);
 
-	void SetFlowEventReceiver(UFlowNode* FlowNode) { FlowEventReceiver = FlowNode; }
+	// Moves Sequence Actor to the Transform Origin and sets it as the instance data, used by both spawned and pooled actors
+	static void ApplyTransformOrigin(AFlowLevelSequenceActor* Actor, AActor* TransformOriginActor);
+	static FTransform GetTransformOriginTransform(AActor* TransformOriginActor);
+
+	void SetFlowEventReceiver(UFlowNode* FlowNode);
+	UFlowNode_PlayLevelSequence* GetPlayLevelSequenceNode() const { return PlayLevelSequenceNode; }
 
 	// IMovieScenePlayer
 	virtual TArray<UObject*> GetEventContexts() const override;
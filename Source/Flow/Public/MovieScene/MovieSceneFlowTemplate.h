@@ -45,11 +45,13 @@ struct FMovieSceneFlowTriggerTemplate : public FMovieSceneFlowTemplateBase
 	FMovieSceneFlowTriggerTemplate() {}
 	FMovieSceneFlowTriggerTemplate(const UMovieSceneFlowTriggerSection& Section, const UMovieSceneFlowTrack& Track);
 
+	// Sorted times of keys with a valid event
 	UPROPERTY()
 	TArray<FFrameNumber> EventTimes;
 
+	// Event names resolved once, when compiling the section, matching EventTimes
 	UPROPERTY()
-	TArray<FString> EventNames;
+	TArray<FName> EventNames;
 
 private:
 	virtual UScriptStruct& GetScriptStructImpl() const override { return *StaticStruct(); }
@@ -65,7 +67,7 @@ struct FMovieSceneFlowRepeaterTemplate : public FMovieSceneFlowTemplateBase
 	FMovieSceneFlowRepeaterTemplate(const UMovieSceneFlowRepeaterSection& Section, const UMovieSceneFlowTrack& Track);
 
 	UPROPERTY()
-	FString EventName;
+	FName EventName;
 
 private:
 	virtual UScriptStruct& GetScriptStructImpl() const override { return *StaticStruct(); }
@@ -8,6 +8,7 @@
 #include "VisualLogger/VisualLoggerDebugSnapshotInterface.h"
 
 #include "FlowMessageLog.h"
+#include "FlowTimerWheel.h"
 #include "FlowTypes.h"
 #include "Nodes/FlowPin.h"
 #include "FlowNode.generated.h"
@@ -15,6 +16,7 @@
 class IFlowOwnerInterface;
 class UFlowAsset;
 class UFlowSubsystem;
+struct FFlowGraphTraversalScratch;
 struct FFlowNodeSaveData;
 
 #if WITH_EDITOR
@@ -34,6 +36,8 @@ class FLOW_API UFlowNode : public UObject, public IVisualLoggerDebugSnapshotInte
 	friend class UFlowGraphSchema;
 	friend class SFlowInputPinHandle;
 	friend class SFlowOutputPinHandle;
+	friend class FFlowTimerWheel;
+	friend class FFlowInspectionObserver;
 
 //////////////////////////////////////////////////////////////////////////
 // Node
@@ -73,6 +77,9 @@ protected:
 
 public:
 	FFlowNodeEvent OnReconstructionRequested;
+
+	// Called after editing any property of this node, i.e. graph node widget refreshes its description
+	FFlowNodeEvent OnPropertyEdited;
 #endif
 
 public:
@@ -80,8 +87,19 @@ public:
 	// UObject	
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 	virtual void PostLoad() override;
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION > 3
+	virtual void GetAssetRegistryTags(FAssetRegistryTagsContext Context) const override;
+#else
+	virtual void GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const override;
+#endif
 	// --
 
+private:
+	// Blueprint passes tags of its class default object, see FFlowNodeBlueprintTags
+	void GetBlueprintNodeTags(TFunctionRef<void(const FName&, const FString&)> AddTag) const;
+
+public:
+
 	// Opportunity to update node's data before UFlowGraphNode would call ReconstructNode()
 	virtual void FixNode(UEdGraphNode* NewGraphNode);
 
@@ -157,6 +175,15 @@ protected:
 	UPROPERTY()
 	EFlowSignalMode SignalMode;
 
+	// Set to StaticClass() by the constructor of a native class that modifies only its own state and its Flow Asset instance
+	// Such node can be evaluated on a worker thread, operations touching the world have to go through UFlowSubsystem::RunOnGameThread
+	const UClass* ThreadSafeClass;
+
+public:
+	// Thread safety isn't inherited, every subclass has to opt in as its overrides might touch the world
+	bool IsThreadSafe() const { return ThreadSafeClass == GetClass(); }
+
+protected:
 #if WITH_EDITOR
 	FFlowMessageLog ValidationLog;
 #endif
@@ -234,6 +261,9 @@ public:
 
 	UFUNCTION(BlueprintPure, Category= "FlowNode")
 	TSet<UFlowNode*> GetConnectedNodes() const;
+
+	// Nodes connected to outputs, as indices in UFlowAsset::GetNodeIndexSpace, served by the graph topology without allocating
+	TConstArrayView<int32> GetConnectedNodeIndices() const;
 	
 	FName GetPinConnectedToNode(const FGuid& OtherNodeGuid);
 
@@ -244,6 +274,7 @@ public:
 	bool IsOutputConnected(const FName& PinName) const;
 
 	static void RecursiveFindNodesByClass(UFlowNode* Node, const TSubclassOf<UFlowNode> Class, uint8 Depth, TArray<UFlowNode*>& OutNodes);
+	static void RecursiveFindNodesByClass(UFlowNode* Node, const TSubclassOf<UFlowNode> Class, uint8 Depth, TArray<UFlowNode*>& OutNodes, FFlowGraphTraversalScratch& Scratch);
 
 //////////////////////////////////////////////////////////////////////////
 // Debugger
@@ -269,8 +300,12 @@ public:
 #if !UE_BUILD_SHIPPING
 
 private:
+	// Filled only while the Flow Asset instance is inspected
 	TMap<FName, TArray<FPinRecord>> InputRecords;
 	TMap<FName, TArray<FPinRecord>> OutputRecords;
+
+	// Out of line, keeps the string formatting away from the signal path
+	FORCENOINLINE void LogInvalidPin(const TCHAR* PinDescription, const FString& Pin);
 #endif
 
 public:
@@ -314,6 +349,10 @@ protected:
 	// Method reacting on triggering Input pin
 	virtual void ExecuteInput(const FName& PinName);
 
+	// Index-based variant of ExecuteInput, called with the index of triggered pin in InputPins
+	// Native nodes can override it to react on pins resolved in FFlowPinTable, default implementation calls ExecuteInput
+	virtual void ExecuteInputByIndex(const int32 PinIndex);
+
 	// Event reacting on triggering Input pin
 	UFUNCTION(BlueprintImplementableEvent, Category = "FlowNode", meta = (DisplayName = "Execute Input"))
 	void K2_ExecuteInput(const FName& PinName);
@@ -329,6 +368,9 @@ protected:
 	void TriggerOutput(const FText& PinName, const bool bFinish = false);
 	void TriggerOutput(const TCHAR* PinName, const bool bFinish = false);
 
+	// Trigger output pin of given index in OutputPins, avoids searching pins by name
+	void TriggerOutputByIndex(const int32 PinIndex, const bool bFinish = false, const EFlowPinActivationType ActivationType = EFlowPinActivationType::Default);
+
 	UFUNCTION(BlueprintCallable, Category = "FlowNode", meta = (HidePin = "ActivationType"))
 	void TriggerOutputPin(const FFlowOutputPinHandle Pin, const bool bFinish = false, const EFlowPinActivationType ActivationType = EFlowPinActivationType::Default);
 
@@ -366,6 +408,28 @@ protected:
 private:
 	void ResetRecords();
 
+public:
+	// UObject
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+	// --
+
+	// Memory allocated by pin records, these are kept for debugging in non-shipping builds
+	SIZE_T GetPinRecordsAllocatedSize() const;
+
+//////////////////////////////////////////////////////////////////////////
+// Timers
+
+protected:
+	// Schedules timer in the Flow Subsystem, its time is affected by time dilation and pausing of the Flow Asset instance
+	FFlowTimerHandle SetFlowTimer(const float Rate, const bool bLoop, const float FirstDelay = -1.0f);
+	void ClearFlowTimer(FFlowTimerHandle& Handle);
+
+	float GetFlowTimerRemaining(const FFlowTimerHandle& Handle) const;
+	float GetFlowTimerElapsed(const FFlowTimerHandle& Handle) const;
+
+	// Called by the Flow Subsystem after timer scheduled by this node expired
+	virtual void OnFlowTimer(const FFlowTimerHandle& Handle) {}
+
 //////////////////////////////////////////////////////////////////////////
 // SaveGame support
 
@@ -396,6 +460,9 @@ public:
 	TMap<uint8, FPinRecord> GetWireRecords() const;
 	TArray<FPinRecord> GetPinRecords(const FName& PinName, const EEdGraphPinDirection PinDirection) const;
 
+	// Latest record of the pin, without copying all pin records
+	const FPinRecord* FindLastPinRecord(const FName& PinName, const EEdGraphPinDirection PinDirection) const;
+
 	// Information displayed while node is working - displayed over node as NodeInfoPopup
 	virtual FString GetStatusString() const;
 	virtual bool GetStatusBackgroundColor(FLinearColor& OutColor) const;
@@ -2,9 +2,45 @@
 
 #pragma once
 
+#include "AssetRegistry/AssetData.h"
 #include "Engine/Blueprint.h"
 #include "FlowNodeBlueprint.generated.h"
 
+#if WITH_EDITOR
+/**
+ * Flow Node class data saved to asset registry tags of the blueprint, written by UFlowNode::GetAssetRegistryTags
+ * Allows listing blueprint nodes in the graph editor without loading them
+ */
+struct FLOW_API FFlowNodeBlueprintTags
+{
+	static const FName PlaceableTag;
+	static const FName CategoryTag;
+	static const FName TitleTag;
+	static const FName ToolTipTag;
+	static const FName KeywordsTag;
+	static const FName ClassHierarchyTag;
+	static const FName AllowedAssetClassesTag;
+	static const FName DeniedAssetClassesTag;
+
+	bool bPlaceable = false;
+	FString Category;
+	FText Title;
+	FText ToolTip;
+	FString Keywords;
+
+	// Path names of the generated class and its parent classes, up to UFlowNode
+	TArray<FName> ClassHierarchy;
+
+	TArray<FName> AllowedAssetClasses;
+	TArray<FName> DeniedAssetClasses;
+
+	// Returns false if the blueprint has been saved before these tags were introduced
+	bool Read(const FAssetData& AssetData);
+
+	FName GetNodeClassPath() const { return ClassHierarchy[0]; }
+};
+#endif
+
 /**
  * A specialized blueprint class required for customizing Asset Type Actions
  */
@@ -182,6 +182,31 @@ struct FLOW_API FConnectedPin
 	}
 };
 
+// Pins declared by the native node class, resolved to indices of pins on the node instance
+// Lets native nodes dispatch inputs and trigger outputs by comparing integers, instead of hashing pin names on every activation
+//  i.e. Table.Bind(MyInputNames, InputPins) in InitializeInstance, then compare PinIndex == Table[EMyInput::Start] in ExecuteInputByIndex
+struct FLOW_API FFlowPinTable
+{
+	// Resolves declared pins once, pins missing on the instance (i.e. asset saved before adding the pin) are mapped to INDEX_NONE
+	void Bind(const TConstArrayView<const TCHAR*> DeclaredPinNames, const TArray<FFlowPin>& Pins)
+	{
+		PinIndices.Reset(DeclaredPinNames.Num());
+		for (const TCHAR* DeclaredPinName : DeclaredPinNames)
+		{
+			PinIndices.Add(Pins.IndexOfByKey(FName(DeclaredPinName)));
+		}
+	}
+
+	// Index of the declared pin in the instance pin array, INDEX_NONE if the instance doesn't have it
+	int32 operator[](const int32 DeclaredIndex) const
+	{
+		return PinIndices.IsValidIndex(DeclaredIndex) ? PinIndices[DeclaredIndex] : INDEX_NONE;
+	}
+
+private:
+	TArray<int32, TInlineAllocator<4>> PinIndices;
+};
+
 UENUM(BlueprintType)
 enum class EFlowPinActivationType : uint8
 {
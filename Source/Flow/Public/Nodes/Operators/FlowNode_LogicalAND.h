@@ -15,6 +15,11 @@ class FLOW_API UFlowNode_LogicalAND final : public UFlowNode
 	GENERATED_UCLASS_BODY()
 
 private:
+	// Executed inputs by pin index, updated without hashing pin names
+	TBitArray<> ExecutedInputs;
+	int32 NumExecutedInputs;
+
+	// Written only while saving the game, so SaveGame doesn't depend on order of input pins
 	UPROPERTY(SaveGame)
 	TSet<FName> ExecutedInputNames;
 	
@@ -24,6 +29,10 @@ public:
 #endif
 
 protected:
-	virtual void ExecuteInput(const FName& PinName) override;
+	virtual void InitializeInstance() override;
+	virtual void ExecuteInputByIndex(const int32 PinIndex) override;
 	virtual void Cleanup() override;
+
+	virtual void OnSave_Implementation() override;
+	virtual void OnLoad_Implementation() override;
 };
@@ -32,8 +32,12 @@ public:
 	virtual bool CanUserAddInput() const override { return true; }
 #endif
 
+private:
+	FFlowPinTable InputTable;
+
 protected:
-	virtual void ExecuteInput(const FName& PinName) override;
+	virtual void InitializeInstance() override;
+	virtual void ExecuteInputByIndex(const int32 PinIndex) override;
 	virtual void Cleanup() override;
 
 	void ResetCounter();
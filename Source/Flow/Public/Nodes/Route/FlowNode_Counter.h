@@ -21,8 +21,12 @@ private:
 	UPROPERTY(SaveGame)
 	int32 CurrentSum;
 
+	FFlowPinTable InputTable;
+	FFlowPinTable OutputTable;
+
 protected:
-	virtual void ExecuteInput(const FName& PinName) override;
+	virtual void InitializeInstance() override;
+	virtual void ExecuteInputByIndex(const int32 PinIndex) override;
 	virtual void Cleanup() override;
 
 #if WITH_EDITOR
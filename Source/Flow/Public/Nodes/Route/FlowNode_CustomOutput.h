@@ -14,7 +14,12 @@ class FLOW_API UFlowNode_CustomOutput final : public UFlowNode_CustomEventBase
 {
 	GENERATED_UCLASS_BODY()
 
+private:
+	// Index of EventName in UFlowAsset::GetCustomOutputEvents
+	int32 EventIndex;
+
 protected:
+	virtual void InitializeInstance() override;
 	virtual void ExecuteInput(const FName& PinName) override;
 
 #if WITH_EDITOR
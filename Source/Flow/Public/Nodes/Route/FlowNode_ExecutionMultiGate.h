@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Nodes/FlowNode.h"
+#include "Math/RandomStream.h"
 #include "FlowNode_ExecutionMultiGate.generated.h"
 
 /**
@@ -28,18 +29,36 @@ private:
 	UPROPERTY(SaveGame)
 	int32 NextOutput;
 
+	// Written only while saving the game, runtime state is kept in CompletedOutputs
 	UPROPERTY(SaveGame)
 	TArray<bool> Completed;
 
+	// Completed outputs by pin index
+	TBitArray<> CompletedOutputs;
+	int32 NumCompletedOutputs;
+
+	FFlowPinTable InputTable;
+
+	// Node can be executed on worker threads, so it doesn't use the global random generator
+	FRandomStream RandomStream;
+
 public:
 #if WITH_EDITOR
 	virtual bool CanUserAddOutput() const override { return true; }
 #endif
 
 protected:
-	virtual void ExecuteInput(const FName& PinName) override;
+	virtual void InitializeInstance() override;
+	virtual void OnActivate() override;
+	virtual void ExecuteInputByIndex(const int32 PinIndex) override;
 	virtual void Cleanup() override;
 
+	virtual void OnSave_Implementation() override;
+	virtual void OnLoad_Implementation() override;
+
+private:
+	void MarkCompleted(const int32 OutputIndex);
+
 #if WITH_EDITOR
 	virtual FString GetNodeDescription() const override;
 #endif
@@ -34,17 +34,30 @@ private:
 	UPROPERTY(SaveGame)
 	FString SavedAssetInstanceName;
 
+	// Flow Asset instance created by this node, bound in UFlowAsset::AttachToSubGraph
+	TWeakObjectPtr<UFlowAsset> SubFlowInstance;
+
+	// Index of the Custom Input event in the SubFlow for every input pin, INDEX_NONE if pin isn't an event
+	TArray<int32> InputPinEvents;
+
+	// Input pin being executed, lets ExecuteInput route custom events without searching pins by name
+	int32 ExecutedInputIndex;
+
 protected:
 	virtual bool CanBeAssetInstanced() const;
 	
 	virtual void PreloadContent() override;
 	virtual void FlushContent() override;
 
+	virtual void ExecuteInputByIndex(const int32 PinIndex) override;
 	virtual void ExecuteInput(const FName& PinName) override;
 	virtual void Cleanup() override;
 
+	void TriggerSubFlowCustomInput(const FName& EventName) const;
+
 public:
 	virtual void ForceFinishNode() override;
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
 
 protected:
 	virtual void OnLoad_Implementation() override;
@@ -2,12 +2,12 @@
 
 #pragma once
 
-#include "Engine/EngineTypes.h"
 #include "Nodes/FlowNode.h"
 #include "FlowNode_Timer.generated.h"
 
 /**
  * Triggers outputs after time elapsed
+ * Timers are scheduled in the Flow Subsystem, so they respect time dilation and pausing of the Flow Asset instance
  */
 UCLASS(NotBlueprintable, meta = (DisplayName = "Timer", Keywords = "delay, step, tick"))
 class FLOW_API UFlowNode_Timer : public UFlowNode
@@ -24,8 +24,8 @@ protected:
 	float StepTime;
 
 private:
-	FTimerHandle CompletionTimerHandle;
-	FTimerHandle StepTimerHandle;
+	FFlowTimerHandle CompletionTimerHandle;
+	FFlowTimerHandle StepTimerHandle;
 
 	UPROPERTY(SaveGame)
 	float SumOfSteps;
@@ -42,11 +42,10 @@ protected:
 	virtual void SetTimer();
 	virtual void Restart();
 	
+	virtual void OnFlowTimer(const FFlowTimerHandle& Handle) override;
+
 private:
-	UFUNCTION()
 	void OnStep();
-
-	UFUNCTION()
 	void OnCompletion();
 
 protected:
@@ -33,11 +33,20 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Call Owner", Instanced)
 	UFlowOwnerFunctionParams* Params;
 
+	// Owner object the FunctionRef has been resolved for
+	TWeakObjectPtr<UObject> ResolvedOwnerObject;
+
+	// Output names accepted as the function result, gathered once per instance
+	TSet<FName> ValidOutputNames;
+
 protected:
 	// UFlowNode
+	virtual void InitializeInstance() override;
 	virtual void ExecuteInput(const FName& PinName) override;
 	// ---
 
+	UObject* TryResolveOwnerFunction(const bool bLogErrors);
+
 	bool TryExecuteOutputPin(const FName& OutputName);
 	bool ShouldFinishForOutputName(const FName& OutputName) const;
 
@@ -22,6 +22,12 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Notify")
 	bool bRetroactive;
 
+	// Client-side node reports observed tags, so server would replicate matching notifies to this client
+	bool bNotifyInterestRegistered;
+
+	virtual void StartObserving() override;
+	virtual void StopObserving() override;
+
 	virtual void ObserveActor(TWeakObjectPtr<AActor> Actor, TWeakObjectPtr<UFlowComponent> Component) override;
 	virtual void ForgetActor(TWeakObjectPtr<AActor> Actor, TWeakObjectPtr<UFlowComponent> Component) override;
 
@@ -104,7 +104,7 @@ protected:
 	virtual void OnLoad_Implementation() override;
 
 private:
-	void TriggerEvent(const FString& EventName);
+	void TriggerEvent(const FName& EventName);
 
 public:
 	void OnTimeDilationUpdate(const float NewTimeDilation);
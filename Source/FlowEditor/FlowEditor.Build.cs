@@ -31,6 +31,7 @@ public class FlowEditor : ModuleRules
 			"EditorScriptingUtilities",
 			"EditorStyle",
 			"Engine",
+			"GameplayTags",
 			"GraphEditor",
 			"InputCore",
 			"Json",
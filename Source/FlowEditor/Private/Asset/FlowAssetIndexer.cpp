@@ -1,16 +1,16 @@
 // Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
 
 #include "Asset/FlowAssetIndexer.h"
+#include "Asset/FlowNodeSearchIndex.h"
 
 #include "FlowAsset.h"
 #include "Nodes/FlowNode.h"
 
+#include "Graph/Nodes/FlowGraphNode.h"
 #include "Graph/Nodes/FlowGraphNode_Reroute.h"
 
 #include "EdGraph/EdGraph.h"
-#include "EdGraph/EdGraphPin.h"
 #include "EdGraphNode_Comment.h"
-#include "Internationalization/Text.h"
 #include "SearchSerializer.h"
 #include "Utility/IndexerUtilities.h"
 
@@ -51,6 +51,9 @@ void FFlowAssetIndexer::IndexAsset(const UObject* InAssetObject, FSearchSerializ
 
 void FFlowAssetIndexer::IndexGraph(const UFlowAsset* InFlowAsset, FSearchSerializer& Serializer) const
 {
+	// collects only nodes changed since the last indexing
+	const TMap<FGuid, FFlowNodeIndexRecord>& NodeRecords = FFlowNodeSearchIndex::Get().UpdateAsset(*InFlowAsset);
+
 	for (UEdGraphNode* Node : InFlowAsset->GetGraph()->Nodes)
 	{
 		// Ignore Reroutes
@@ -68,60 +71,45 @@ void FFlowAssetIndexer::IndexGraph(const UFlowAsset* InFlowAsset, FSearchSeriali
 			continue;
 		}
 
+		const UFlowGraphNode* FlowGraphNode = Cast<UFlowGraphNode>(Node);
+		const UFlowNode* FlowNode = FlowGraphNode ? FlowGraphNode->GetFlowNode() : nullptr;
+		const FFlowNodeIndexRecord* Record = FlowNode ? NodeRecords.Find(FlowNode->GetGuid()) : nullptr;
+		if (Record == nullptr)
+		{
+			continue;
+		}
+
 		// Indexing UEdGraphNode
 		{
-			const FText NodeText = Node->GetNodeTitle(ENodeTitleType::MenuTitle);
-			Serializer.BeginIndexingObject(Node, NodeText);
-			Serializer.IndexProperty(TEXT("Title"), NodeText);
+			Serializer.BeginIndexingObject(Node, Record->Title);
+			Serializer.IndexProperty(TEXT("Title"), Record->Title);
 
 			if (!Node->NodeComment.IsEmpty())
 			{
 				Serializer.IndexProperty(TEXT("Comment"), Node->NodeComment);
 			}
 
-			for (const UEdGraphPin* Pin : Node->GetAllPins())
+			for (const TPair<FString, FText>& PinValue : Record->PinValues)
 			{
-				if (Pin->Direction == EGPD_Input && Pin->LinkedTo.Num() == 0)
-				{
-					const FText PinText = Pin->GetDisplayName();
-					if (PinText.IsEmpty())
-					{
-						continue;
-					}
-
-					const FText PinValue = Pin->GetDefaultAsText();
-					if (PinValue.IsEmpty())
-					{
-						continue;
-					}
-
-					const FString PinLabel = TEXT("[Pin] ") + *FTextInspector::GetSourceString(PinText);
-					Serializer.IndexProperty(PinLabel, PinValue);
-				}
+				Serializer.IndexProperty(PinValue.Key, PinValue.Value);
 			}
 
-			// This will serialize any user exposed options for the node that are editable in the Details
-			FIndexerUtilities::IterateIndexableProperties(Node, [&Serializer](const FProperty* Property, const FString& Value)
+			for (const TPair<FString, FString>& Property : Record->GraphNodeProperties)
 			{
-				Serializer.IndexProperty(Property, Value);
-			});
+				Serializer.IndexProperty(Property.Key, Property.Value);
+			}
 
 			Serializer.EndIndexingObject();
 		}
 
 		// Indexing Flow Node
-		if (const UFlowGraphNode* FlowGraphNode = Cast<UFlowGraphNode>(Node))
 		{
-			if (const UFlowNode* FlowNode = FlowGraphNode->GetFlowNode())
+			Serializer.BeginIndexingObject(FlowNode, Record->FlowNodeFriendlyName);
+			for (const TPair<FString, FString>& Property : Record->FlowNodeProperties)
 			{
-				const FString NodeFriendlyName = FString::Printf(TEXT("%s: %s"), *FlowNode->GetClass()->GetName(), *FlowNode->GetNodeDescription());
-				Serializer.BeginIndexingObject(FlowNode, NodeFriendlyName);
-				FIndexerUtilities::IterateIndexableProperties(FlowNode, [&Serializer](const FProperty* Property, const FString& Value)
-				{
-					Serializer.IndexProperty(Property, Value);
-				});
-				Serializer.EndIndexingObject();
+				Serializer.IndexProperty(Property.Key, Property.Value);
 			}
+			Serializer.EndIndexingObject();
 		}
 	}
 }
@@ -4,6 +4,7 @@
 #include "Asset/FlowAssetEditor.h"
 #include "Asset/FlowMessageLogListing.h"
 
+#include "FlowComponent.h"
 #include "FlowSubsystem.h"
 
 #include "Editor/UnrealEdEngine.h"
@@ -25,6 +26,8 @@ UFlowDebuggerSubsystem::UFlowDebuggerSubsystem()
 
 	UFlowSubsystem::OnInstancedTemplateAdded.BindUObject(this, &UFlowDebuggerSubsystem::OnInstancedTemplateAdded);
 	UFlowSubsystem::OnInstancedTemplateRemoved.BindUObject(this, &UFlowDebuggerSubsystem::OnInstancedTemplateRemoved);
+
+	UFlowComponent::OnRootFlowStatesReplicatedNative.BindUObject(this, &UFlowDebuggerSubsystem::OnRootFlowStatesReplicated);
 }
 
 void UFlowDebuggerSubsystem::OnInstancedTemplateAdded(UFlowAsset* FlowAsset)
@@ -51,10 +54,35 @@ void UFlowDebuggerSubsystem::OnRuntimeMessageAdded(UFlowAsset* FlowAsset, const
 	}
 }
 
+void UFlowDebuggerSubsystem::OnRootFlowStatesReplicated(UFlowComponent* FlowComponent)
+{
+	ReplicatedStateComponents.AddUnique(FlowComponent);
+}
+
+EFlowNodeState UFlowDebuggerSubsystem::GetReplicatedNodeState(const UFlowAsset* TemplateAsset, const FGuid& NodeGuid) const
+{
+	for (const TWeakObjectPtr<UFlowComponent>& FlowComponent : ReplicatedStateComponents)
+	{
+		if (const FFlowRootFlowState* State = FlowComponent.IsValid() ? FlowComponent->FindRootFlowState(TemplateAsset) : nullptr)
+		{
+			if (State->IsNodeActive(NodeGuid))
+			{
+				return EFlowNodeState::Active;
+			}
+
+			// replicated state doesn't distinguish aborted nodes
+			return State->IsNodeCompleted(NodeGuid) ? EFlowNodeState::Completed : EFlowNodeState::NeverActivated;
+		}
+	}
+
+	return EFlowNodeState::NeverActivated;
+}
+
 void UFlowDebuggerSubsystem::OnBeginPIE(const bool bIsSimulating)
 {
 	// clear all logs from a previous session
 	RuntimeLogs.Empty();
+	ReplicatedStateComponents.Empty();
 }
 
 void UFlowDebuggerSubsystem::OnEndPIE(const bool bIsSimulating)
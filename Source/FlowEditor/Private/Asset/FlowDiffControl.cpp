@@ -4,7 +4,11 @@
 #include "Asset/SFlowDiff.h"
 
 #include "FlowAsset.h"
+#include "Graph/Nodes/FlowGraphNode.h"
+#include "Nodes/FlowNode.h"
 
+#include "Algo/BinarySearch.h"
+#include "Async/Async.h"
 #include "EdGraph/EdGraph.h"
 #include "GraphDiffControl.h"
 #include "SBlueprintDiff.h"
@@ -50,6 +54,343 @@ void FFlowAssetDiffControl::GenerateTreeEntries(TArray<TSharedPtr<FBlueprintDiff
 	));
 }
 
+/////////////////////////////////////////////////////////////////////////////
+/// FlowGraphDiff: snapshots taken on the game thread, compared on a background task
+
+namespace FlowGraphDiff
+{
+	// number of differences sent to the game thread at once
+	constexpr int32 BatchSize = 32;
+
+	struct FPinSnapshot
+	{
+		// never dereferenced outside of the game thread
+		UEdGraphPin* Pin = nullptr;
+
+		FName PinName;
+		EEdGraphPinDirection Direction = EGPD_Input;
+		uint32 DefaultValueHash = 0;
+		TArray<TPair<FGuid, FName>> LinkedTo;
+	};
+
+	struct FPropertySnapshot
+	{
+		FName Name;
+		FText DisplayName;
+		uint32 ValueHash = 0;
+	};
+
+	struct FNodeSnapshot
+	{
+		// never dereferenced outside of the game thread
+		UEdGraphNode* Node = nullptr;
+		const UClass* NodeClass = nullptr;
+
+		FGuid NodeGuid;
+		FText Title;
+		FIntPoint Position;
+		uint32 CommentHash = 0;
+
+		TArray<FPinSnapshot> Pins;
+		TArray<FPropertySnapshot> Properties;
+	};
+
+	static uint32 HashPropertyValue(const FProperty* Property, const UObject* Container)
+	{
+		// subobjects of the asset live in a different package in every revision, compare only their relative paths
+		if (const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property); ObjectProperty && Property->ArrayDim == 1)
+		{
+			const UObject* Value = ObjectProperty->GetObjectPropertyValue_InContainer(Container);
+			if (Value && Value->IsIn(Container->GetOutermost()))
+			{
+				return HashCombine(GetTypeHash(Value->GetClass()->GetFName()), FCrc::StrCrc32(*Value->GetPathName(Container->GetOutermost())));
+			}
+		}
+
+		FString ValueText;
+		for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ArrayIndex++)
+		{
+			Property->ExportText_InContainer(ArrayIndex, ValueText, Container, nullptr, nullptr, PPF_None);
+		}
+		return FCrc::StrCrc32(*ValueText);
+	}
+
+	static void SnapshotProperties(const UObject* Object, TArray<FPropertySnapshot>& OutProperties)
+	{
+		static const FName SignalModeName = TEXT("SignalMode");
+
+		for (TFieldIterator<FProperty> It(Object->GetClass()); It; ++It)
+		{
+			// signal mode isn't exposed to the details panel, but it's changed by designers
+			if (It->HasAnyPropertyFlags(CPF_Edit) || (Object->IsA<UFlowNode>() && It->GetFName() == SignalModeName))
+			{
+				FPropertySnapshot& PropertySnapshot = OutProperties.Emplace_GetRef();
+				PropertySnapshot.Name = It->GetFName();
+				PropertySnapshot.DisplayName = It->GetDisplayNameText();
+				PropertySnapshot.ValueHash = HashPropertyValue(*It, Object);
+			}
+		}
+	}
+
+	static void SnapshotGraph(const UEdGraph* Graph, TArray<FNodeSnapshot>& OutNodes)
+	{
+		if (Graph == nullptr)
+		{
+			return;
+		}
+
+		OutNodes.Reserve(Graph->Nodes.Num());
+		for (UEdGraphNode* Node : Graph->Nodes)
+		{
+			if (Node == nullptr)
+			{
+				continue;
+			}
+
+			FNodeSnapshot& NodeSnapshot = OutNodes.Emplace_GetRef();
+			NodeSnapshot.Node = Node;
+			NodeSnapshot.NodeGuid = Node->NodeGuid;
+			NodeSnapshot.Title = Node->GetNodeTitle(ENodeTitleType::ListView);
+			NodeSnapshot.Position = FIntPoint(Node->NodePosX, Node->NodePosY);
+			NodeSnapshot.CommentHash = FCrc::StrCrc32(*Node->NodeComment);
+
+			NodeSnapshot.Pins.Reserve(Node->Pins.Num());
+			for (UEdGraphPin* Pin : Node->Pins)
+			{
+				FPinSnapshot& PinSnapshot = NodeSnapshot.Pins.Emplace_GetRef();
+				PinSnapshot.Pin = Pin;
+				PinSnapshot.PinName = Pin->PinName;
+				PinSnapshot.Direction = Pin->Direction;
+				PinSnapshot.DefaultValueHash = FCrc::StrCrc32(*Pin->GetDefaultAsString());
+
+				PinSnapshot.LinkedTo.Reserve(Pin->LinkedTo.Num());
+				for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+				{
+					if (LinkedPin && LinkedPin->GetOwningNodeUnchecked())
+					{
+						PinSnapshot.LinkedTo.Emplace(LinkedPin->GetOwningNodeUnchecked()->NodeGuid, LinkedPin->PinName);
+					}
+				}
+			}
+
+			SnapshotProperties(Node, NodeSnapshot.Properties);
+
+			const UFlowGraphNode* FlowGraphNode = Cast<UFlowGraphNode>(Node);
+			const UFlowNode* FlowNode = FlowGraphNode ? FlowGraphNode->GetFlowNode() : nullptr;
+			NodeSnapshot.NodeClass = FlowNode ? FlowNode->GetClass() : Node->GetClass();
+			if (FlowNode)
+			{
+				SnapshotProperties(FlowNode, NodeSnapshot.Properties);
+			}
+		}
+	}
+
+	static const FPinSnapshot* FindPin(const FNodeSnapshot& NodeSnapshot, const FPinSnapshot& OtherPin)
+	{
+		return NodeSnapshot.Pins.FindByPredicate([&OtherPin](const FPinSnapshot& Pin)
+		{
+			return Pin.Direction == OtherPin.Direction && Pin.PinName == OtherPin.PinName;
+		});
+	}
+
+	static bool HasSameLinks(const FPinSnapshot& A, const FPinSnapshot& B)
+	{
+		if (A.LinkedTo.Num() != B.LinkedTo.Num())
+		{
+			return false;
+		}
+
+		for (const TPair<FGuid, FName>& Link : A.LinkedTo)
+		{
+			if (!B.LinkedTo.Contains(Link))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	static FDiffSingleResult MakeResult(const EDiffType::Type Diff, const EDiffType::Category Category, const FLinearColor& Color, UEdGraphNode* Node1, UEdGraphNode* Node2, const FText& DisplayString, const FString& OwningObjectPath)
+	{
+		FDiffSingleResult Result;
+		Result.Diff = Diff;
+		Result.Category = Category;
+		Result.DisplayColor = Color;
+		Result.Node1 = Node1;
+		Result.Node2 = Node2;
+		Result.DisplayString = DisplayString;
+		Result.ToolTip = DisplayString;
+		Result.OwningObjectPath = OwningObjectPath;
+		return Result;
+	}
+
+	/** Runs on a background task, reads only the snapshots */
+	class FGraphComparison
+	{
+	public:
+		FGraphComparison(TArray<FNodeSnapshot>&& InOldNodes, TArray<FNodeSnapshot>&& InNewNodes, const FString& InOwningObjectPath, TFunction<void(TArray<FDiffSingleResult>&&)>&& InEmitBatch, const TSharedPtr<FThreadSafeBool, ESPMode::ThreadSafe>& InCancel)
+			: OldNodes(MoveTemp(InOldNodes))
+			, NewNodes(MoveTemp(InNewNodes))
+			, OwningObjectPath(InOwningObjectPath)
+			, EmitBatch(MoveTemp(InEmitBatch))
+			, bCancel(InCancel)
+		{
+		}
+
+		void Run()
+		{
+			TMap<FGuid, const FNodeSnapshot*> OldNodesByGuid;
+			OldNodesByGuid.Reserve(OldNodes.Num());
+			for (const FNodeSnapshot& OldNode : OldNodes)
+			{
+				OldNodesByGuid.Add(OldNode.NodeGuid, &OldNode);
+			}
+
+			TMap<FGuid, const FNodeSnapshot*> NewNodesByGuid;
+			NewNodesByGuid.Reserve(NewNodes.Num());
+			for (const FNodeSnapshot& NewNode : NewNodes)
+			{
+				NewNodesByGuid.Add(NewNode.NodeGuid, &NewNode);
+			}
+
+			// results are streamed as found, the game thread inserts them in the order of EDiffType, like the generic graph diff sorts them
+			for (const FNodeSnapshot& OldNode : OldNodes)
+			{
+				if (!NewNodesByGuid.Contains(OldNode.NodeGuid))
+				{
+					Add(MakeResult(EDiffType::NODE_REMOVED, EDiffType::SUBTRACTION, FLinearColor(1.0f, 0.4f, 0.4f), OldNode.Node, nullptr,
+						FText::Format(LOCTEXT("NodeRemoved", "Removed Node '{0}'"), OldNode.Title), OwningObjectPath));
+				}
+			}
+
+			for (const FNodeSnapshot& NewNode : NewNodes)
+			{
+				if (!OldNodesByGuid.Contains(NewNode.NodeGuid))
+				{
+					Add(MakeResult(EDiffType::NODE_ADDED, EDiffType::ADDITION, FLinearColor(0.3f, 1.0f, 0.4f), NewNode.Node, nullptr,
+						FText::Format(LOCTEXT("NodeAdded", "Added Node '{0}'"), NewNode.Title), OwningObjectPath));
+				}
+			}
+
+			for (const FNodeSnapshot& NewNode : NewNodes)
+			{
+				if (*bCancel)
+				{
+					return;
+				}
+
+				if (const FNodeSnapshot* const* OldNode = OldNodesByGuid.Find(NewNode.NodeGuid))
+				{
+					DiffNodes(**OldNode, NewNode);
+				}
+			}
+
+			Flush();
+		}
+
+	private:
+		void DiffNodes(const FNodeSnapshot& OldNode, const FNodeSnapshot& NewNode)
+		{
+			for (const FPinSnapshot& NewPin : NewNode.Pins)
+			{
+				const FPinSnapshot* OldPin = FindPin(OldNode, NewPin);
+				if (OldPin == nullptr)
+				{
+					continue;
+				}
+
+				// Flow connections are stored by output pins, checking them reports every changed wire once
+				if (NewPin.Direction == EGPD_Output && !HasSameLinks(*OldPin, NewPin))
+				{
+					FDiffSingleResult Result = MakeResult(EDiffType::PIN_LINKEDTO_NODE, EDiffType::MODIFICATION, FLinearColor(0.85f, 0.71f, 0.25f), OldNode.Node, NewNode.Node,
+						FText::Format(LOCTEXT("PinLinksChanged", "Pin '{0}' connections changed on '{1}'"), FText::FromName(NewPin.PinName), NewNode.Title), OwningObjectPath);
+					Result.Pin1 = OldPin->Pin;
+					Result.Pin2 = NewPin.Pin;
+					Add(MoveTemp(Result));
+				}
+
+				if (OldPin->DefaultValueHash != NewPin.DefaultValueHash)
+				{
+					FDiffSingleResult Result = MakeResult(EDiffType::PIN_DEFAULT_VALUE, EDiffType::MODIFICATION, FLinearColor(0.85f, 0.71f, 0.25f), OldNode.Node, NewNode.Node,
+						FText::Format(LOCTEXT("PinDefaultValueChanged", "Pin '{0}' default value changed on '{1}'"), FText::FromName(NewPin.PinName), NewNode.Title), OwningObjectPath);
+					Result.Pin1 = OldPin->Pin;
+					Result.Pin2 = NewPin.Pin;
+					Add(MoveTemp(Result));
+				}
+			}
+
+			bool bPinsChanged = OldNode.Pins.Num() != NewNode.Pins.Num();
+			for (int32 Index = 0; !bPinsChanged && Index < NewNode.Pins.Num(); Index++)
+			{
+				bPinsChanged = FindPin(OldNode, NewNode.Pins[Index]) == nullptr;
+			}
+			if (bPinsChanged)
+			{
+				Add(MakeResult(EDiffType::NODE_PIN_COUNT, EDiffType::MODIFICATION, FLinearColor(0.45f, 0.4f, 0.4f), OldNode.Node, NewNode.Node,
+					FText::Format(LOCTEXT("PinsChanged", "Pins changed on '{0}'"), NewNode.Title), OwningObjectPath));
+			}
+
+			if (OldNode.Position != NewNode.Position)
+			{
+				Add(MakeResult(EDiffType::NODE_MOVED, EDiffType::MINOR, FLinearColor(0.9f, 0.84f, 0.43f), OldNode.Node, NewNode.Node,
+					FText::Format(LOCTEXT("NodeMoved", "Moved Node '{0}'"), NewNode.Title), OwningObjectPath));
+			}
+
+			if (OldNode.CommentHash != NewNode.CommentHash)
+			{
+				Add(MakeResult(EDiffType::NODE_COMMENT, EDiffType::MODIFICATION, FLinearColor(0.25f, 0.4f, 0.5f), OldNode.Node, NewNode.Node,
+					FText::Format(LOCTEXT("CommentChanged", "Comment changed on '{0}'"), NewNode.Title), OwningObjectPath));
+			}
+
+			if (OldNode.NodeClass != NewNode.NodeClass)
+			{
+				Add(MakeResult(EDiffType::NODE_PROPERTY, EDiffType::MODIFICATION, FLinearColor(0.25f, 0.4f, 0.5f), OldNode.Node, NewNode.Node,
+					FText::Format(LOCTEXT("NodeClassChanged", "Class changed on '{0}'"), NewNode.Title), OwningObjectPath));
+				return;
+			}
+
+			// the same class lists the same properties in the same order
+			for (int32 Index = 0; Index < NewNode.Properties.Num() && Index < OldNode.Properties.Num(); Index++)
+			{
+				const FPropertySnapshot& OldProperty = OldNode.Properties[Index];
+				const FPropertySnapshot& NewProperty = NewNode.Properties[Index];
+				if (OldProperty.Name == NewProperty.Name && OldProperty.ValueHash != NewProperty.ValueHash)
+				{
+					Add(MakeResult(EDiffType::NODE_PROPERTY, EDiffType::MODIFICATION, FLinearColor(0.25f, 0.4f, 0.5f), OldNode.Node, NewNode.Node,
+						FText::Format(LOCTEXT("PropertyChanged", "Property '{0}' changed on '{1}'"), NewProperty.DisplayName, NewNode.Title), OwningObjectPath));
+				}
+			}
+		}
+
+		void Add(FDiffSingleResult&& Result)
+		{
+			Batch.Add(MoveTemp(Result));
+			if (Batch.Num() >= BatchSize)
+			{
+				Flush();
+			}
+		}
+
+		void Flush()
+		{
+			if (Batch.Num() > 0 && !*bCancel)
+			{
+				EmitBatch(MoveTemp(Batch));
+			}
+			Batch.Reset();
+		}
+
+		TArray<FNodeSnapshot> OldNodes;
+		TArray<FNodeSnapshot> NewNodes;
+		FString OwningObjectPath;
+
+		TArray<FDiffSingleResult> Batch;
+		TFunction<void(TArray<FDiffSingleResult>&&)> EmitBatch;
+		TSharedPtr<FThreadSafeBool, ESPMode::ThreadSafe> bCancel;
+	};
+}
+
 /////////////////////////////////////////////////////////////////////////////
 /// FFlowGraphToDiff
 
@@ -67,12 +408,15 @@ FFlowGraphToDiff::FFlowGraphToDiff(SFlowDiff* InDiffWidget, UEdGraph* InGraphOld
 	{
 		OnGraphChangedDelegateHandle = InGraphNew->AddOnGraphChangedHandler(FOnGraphChanged::FDelegate::CreateRaw(this, &FFlowGraphToDiff::OnGraphChanged));
 	}
-
-	BuildDiffSourceArray();
 }
 
 FFlowGraphToDiff::~FFlowGraphToDiff()
 {
+	if (bCancelDiff.IsValid())
+	{
+		*bCancelDiff = true;
+	}
+
 	if (GraphNew)
 	{
 		GraphNew->RemoveOnGraphChangedHandler(OnGraphChangedDelegateHandle);
@@ -98,15 +442,33 @@ void FFlowGraphToDiff::GenerateTreeEntries(TArray<TSharedPtr<FBlueprintDifferenc
 
 	if (Children.Num() == 0)
 	{
-		// make one child informing the user that there are no differences:
-		Children.Push(FBlueprintDifferenceTreeEntry::NoDifferencesEntry());
+		if (bCancelDiff.IsValid() && !bDiffInProgress)
+		{
+			// make one child informing the user that there are no differences:
+			Children.Push(FBlueprintDifferenceTreeEntry::NoDifferencesEntry());
+		}
+		else
+		{
+			// placeholder replaced by the first batch of differences
+			Children.Push(MakeShared<FBlueprintDifferenceTreeEntry>(FOnDiffEntryFocused(), FGenerateDiffEntryWidget::CreateLambda([]()
+			{
+				return SNew(STextBlock)
+					.ColorAndOpacity(FLinearColor(0.7f, 0.7f, 0.7f))
+					.Text(LOCTEXT("SearchingForDifferences", "Searching for differences..."));
+			})));
+		}
 	}
 
-	const TSharedPtr<FBlueprintDifferenceTreeEntry> Entry = MakeShared<FBlueprintDifferenceTreeEntry>(
+	GraphEntry = MakeShared<FBlueprintDifferenceTreeEntry>(
 		FOnDiffEntryFocused::CreateRaw(DiffWidget, &SFlowDiff::OnGraphSelectionChanged, TSharedPtr<FFlowGraphToDiff>(AsShared()), ESelectInfo::Direct),
 		FGenerateDiffEntryWidget::CreateSP(AsShared(), &FFlowGraphToDiff::GenerateCategoryWidget),
 		Children);
-	OutTreeEntries.Push(Entry);
+	OutTreeEntries.Push(GraphEntry);
+
+	if (!bCancelDiff.IsValid())
+	{
+		StartDiff();
+	}
 }
 
 FText FFlowGraphToDiff::GetToolTip() const
@@ -117,6 +479,10 @@ FText FFlowGraphToDiff::GetToolTip() const
 		{
 			return LOCTEXT("ContainsDifferences", "Revisions are different");
 		}
+		else if (bDiffInProgress)
+		{
+			return LOCTEXT("SearchingRevisions", "Searching for differences between revisions");
+		}
 		else
 		{
 			return LOCTEXT("GraphsIdentical", "Revisions appear to be identical");
@@ -164,30 +530,101 @@ TSharedRef<SWidget> FFlowGraphToDiff::GenerateCategoryWidget() const
 		+ DiffViewUtils::Box(GraphNew != nullptr, Color);
 }
 
-void FFlowGraphToDiff::BuildDiffSourceArray()
+void FFlowGraphToDiff::StartDiff()
 {
 	FoundDiffs->Empty();
-	FGraphDiffControl::DiffGraphs(GraphOld, GraphNew, *FoundDiffs);
+	DiffListSource.Empty();
+
+	// UObjects are read only here, the background task works on plain copies
+	TArray<FlowGraphDiff::FNodeSnapshot> OldNodes;
+	TArray<FlowGraphDiff::FNodeSnapshot> NewNodes;
+	FlowGraphDiff::SnapshotGraph(GraphOld, OldNodes);
+	FlowGraphDiff::SnapshotGraph(GraphNew, NewNodes);
+
+	bDiffInProgress = true;
+	bCancelDiff = MakeShared<FThreadSafeBool, ESPMode::ThreadSafe>(false);
 
-#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION < 3
-	struct SortDiff
+	TWeakPtr<FFlowGraphToDiff> WeakThis = AsShared();
+	auto EmitBatch = [WeakThis](TArray<FDiffSingleResult>&& Batch)
 	{
-		bool operator ()(const FDiffSingleResult& A, const FDiffSingleResult& B) const
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Batch = MoveTemp(Batch)]() mutable
 		{
-			return A.Diff < B.Diff;
-		}
+			if (const TSharedPtr<FFlowGraphToDiff> This = WeakThis.Pin())
+			{
+				This->AddFoundDiffs(MoveTemp(Batch));
+			}
+		});
 	};
 
-	Sort(FoundDiffs->GetData(), FoundDiffs->Num(), SortDiff());
-#else
-	Algo::SortBy(*FoundDiffs, &FDiffSingleResult::Diff);
-#endif	
+	const FString OwningObjectPath = FGraphDiffControl::GetGraphPath(GraphNew ? GraphNew : GraphOld);
+	TSharedRef<FlowGraphDiff::FGraphComparison> Comparison = MakeShared<FlowGraphDiff::FGraphComparison>(MoveTemp(OldNodes), MoveTemp(NewNodes), OwningObjectPath, MoveTemp(EmitBatch), bCancelDiff);
 
-	DiffListSource.Empty();
-	for (const FDiffSingleResult& Diff : *FoundDiffs)
+	Async(EAsyncExecution::ThreadPool, [Comparison, WeakThis]()
+	{
+		Comparison->Run();
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis]()
+		{
+			if (const TSharedPtr<FFlowGraphToDiff> This = WeakThis.Pin())
+			{
+				This->FinishDiff();
+			}
+		});
+	});
+}
+
+void FFlowGraphToDiff::AddFoundDiffs(TArray<FDiffSingleResult>&& NewDiffs)
+{
+	check(IsInGameThread());
+
+	if (DiffListSource.IsEmpty())
+	{
+		// remove the placeholder
+		GraphEntry->Children.Reset();
+	}
+
+	// differences of the graph are the last ones in the tree, they start after entries generated before the diff
+	if (RealDifferencesStartIndex == INDEX_NONE)
+	{
+		RealDifferencesStartIndex = DiffWidget->GetNumRealDifferences();
+	}
+
+	FoundDiffs->Reserve(FoundDiffs->Num() + NewDiffs.Num());
+	DiffListSource.Reserve(DiffListSource.Num() + NewDiffs.Num());
+	for (FDiffSingleResult& Diff : NewDiffs)
 	{
-		DiffListSource.Add(MakeShared<FDiffResultItem>(Diff));
+		// after the differences of the same type, so they keep the order they were found in
+		const int32 Index = Algo::UpperBoundBy(*FoundDiffs, Diff.Diff, [](const FDiffSingleResult& Result)
+		{
+			return Result.Diff;
+		});
+
+		const TSharedPtr<FDiffResultItem> Difference = MakeShared<FDiffResultItem>(Diff);
+		DiffListSource.Insert(Difference, Index);
+		FoundDiffs->Insert(MoveTemp(Diff), Index);
+
+		TSharedPtr<FBlueprintDifferenceTreeEntry> ChildEntry = MakeShared<FBlueprintDifferenceTreeEntry>(
+			FOnDiffEntryFocused::CreateRaw(DiffWidget, &SFlowDiff::OnDiffListSelectionChanged, Difference),
+			FGenerateDiffEntryWidget::CreateSP(Difference.ToSharedRef(), &FDiffResultItem::GenerateWidget));
+		GraphEntry->Children.Insert(ChildEntry, Index);
+		DiffWidget->InsertGraphDifference(RealDifferencesStartIndex + Index, ChildEntry);
 	}
+
+	DiffWidget->RefreshDifferencesTree();
+}
+
+void FFlowGraphToDiff::FinishDiff()
+{
+	bDiffInProgress = false;
+
+	if (DiffListSource.IsEmpty())
+	{
+		GraphEntry->Children.Reset();
+		GraphEntry->Children.Add(FBlueprintDifferenceTreeEntry::NoDifferencesEntry());
+	}
+
+	DiffWidget->RefreshDifferencesTree();
+	DiffWidget->OnGraphDiffFinished(this);
 }
 
 void FFlowGraphToDiff::OnGraphChanged(const FEdGraphEditAction& Action) const
@@ -0,0 +1,462 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Asset/FlowNodeSearchIndex.h"
+
+#include "FlowAsset.h"
+#include "Nodes/FlowNode.h"
+
+#include "Graph/Nodes/FlowGraphNode.h"
+#include "Graph/Nodes/FlowGraphNode_Reroute.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphPin.h"
+#include "HAL/IConsoleManager.h"
+#include "Hash/CityHash.h"
+#include "Internationalization/Text.h"
+#include "Misc/ScopeRWLock.h"
+#include "Serialization/ObjectWriter.h"
+#include "UObject/UObjectGlobals.h"
+#include "Utility/IndexerUtilities.h"
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice FlowBuildNodeIndexCommand(
+	TEXT("Flow.BuildNodeIndex"),
+	TEXT("Loads all Flow Assets missing in the node search index"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		const FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName);
+
+		TArray<FAssetData> FlowAssets;
+		AssetRegistryModule.Get().GetAssetsByClass(UFlowAsset::StaticClass()->GetClassPathName(), FlowAssets, true);
+
+		FFlowNodeSearchIndex::Get().IndexAssets(FlowAssets);
+		Ar.Logf(TEXT("Flow.BuildNodeIndex: %d Flow Assets found, %d already indexed"), FlowAssets.Num(), FFlowNodeSearchIndex::Get().GetNumIndexedAssets());
+	}));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice FlowFindNodesCommand(
+	TEXT("Flow.FindNodes"),
+	TEXT("Lists indexed Flow Nodes by class, gameplay tag or referenced sub-graph. Usage: Flow.FindNodes Class|Tag|SubGraph <Name>"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		if (Args.Num() < 2)
+		{
+			Ar.Logf(TEXT("Usage: Flow.FindNodes Class|Tag|SubGraph <Name>"));
+			return;
+		}
+
+		const FFlowNodeSearchIndex& SearchIndex = FFlowNodeSearchIndex::Get();
+		TArray<FFlowNodeReference> FoundNodes;
+
+		if (Args[0] == TEXT("Class"))
+		{
+			const UClass* NodeClass = UClass::TryFindTypeSlow<UClass>(Args[1]);
+			if (NodeClass == nullptr)
+			{
+				Ar.Logf(TEXT("Flow.FindNodes: class %s not found, blueprint classes have to be loaded"), *Args[1]);
+				return;
+			}
+			FoundNodes = SearchIndex.FindNodesByClass(NodeClass);
+		}
+		else if (Args[0] == TEXT("Tag"))
+		{
+			FoundNodes = SearchIndex.FindNodesByTag(FGameplayTag::RequestGameplayTag(FName(*Args[1]), false));
+		}
+		else if (Args[0] == TEXT("SubGraph"))
+		{
+			FoundNodes = SearchIndex.FindSubGraphReferences(FSoftObjectPath(Args[1]));
+		}
+
+		for (const FFlowNodeReference& NodeReference : FoundNodes)
+		{
+			Ar.Logf(TEXT("%s %s"), *NodeReference.Asset.ToString(), *NodeReference.NodeGuid.ToString());
+		}
+		Ar.Logf(TEXT("Flow.FindNodes: %d nodes found in %d indexed Flow Assets"), FoundNodes.Num(), SearchIndex.GetNumIndexedAssets());
+	}));
+
+static void AppendReferences(const FSoftObjectPath& AssetPath, const TArray<FGuid>& NodeGuids, TArray<FFlowNodeReference>& OutReferences)
+{
+	for (const FGuid& NodeGuid : NodeGuids)
+	{
+		OutReferences.Emplace(AssetPath, NodeGuid);
+	}
+}
+
+FFlowNodeSearchIndex& FFlowNodeSearchIndex::Get()
+{
+	static FFlowNodeSearchIndex SearchIndex;
+	return SearchIndex;
+}
+
+void FFlowNodeSearchIndex::Initialize()
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+	AssetRegistry.OnAssetRemoved().AddRaw(this, &FFlowNodeSearchIndex::OnAssetRemoved);
+	AssetRegistry.OnAssetRenamed().AddRaw(this, &FFlowNodeSearchIndex::OnAssetRenamed);
+}
+
+void FFlowNodeSearchIndex::Deinitialize()
+{
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(AssetRegistryConstants::ModuleName))
+	{
+		AssetRegistryModule->Get().OnAssetRemoved().RemoveAll(this);
+		AssetRegistryModule->Get().OnAssetRenamed().RemoveAll(this);
+	}
+
+	FWriteScopeLock WriteLock(Lock);
+	IndexedAssets.Empty();
+	NodesByClass.Empty();
+	ClassHierarchies.Empty();
+	NodesByTag.Empty();
+	SubGraphReferences.Empty();
+	PendingLoads.Empty();
+}
+
+const TMap<FGuid, FFlowNodeIndexRecord>& FFlowNodeSearchIndex::UpdateAsset(const UFlowAsset& FlowAsset)
+{
+	check(IsInGameThread());
+
+	const FSoftObjectPath AssetPath(&FlowAsset);
+	PendingLoads.Remove(AssetPath);
+
+	// only the game thread modifies the index, no need to lock while collecting nodes
+	const TMap<FGuid, FFlowNodeIndexRecord>* OldRecords = IndexedAssets.Find(AssetPath);
+	TMap<FGuid, FFlowNodeIndexRecord> NewRecords;
+
+	if (const UEdGraph* FlowGraph = FlowAsset.GetGraph())
+	{
+		for (const UEdGraphNode* Node : FlowGraph->Nodes)
+		{
+			// Ignore Reroutes
+			if (Cast<UFlowGraphNode_Reroute>(Node))
+			{
+				continue;
+			}
+
+			const UFlowGraphNode* FlowGraphNode = Cast<UFlowGraphNode>(Node);
+			const UFlowNode* FlowNode = FlowGraphNode ? FlowGraphNode->GetFlowNode() : nullptr;
+			if (FlowNode == nullptr)
+			{
+				continue;
+			}
+
+			const uint64 ContentHash = CalcContentHash(*FlowGraphNode, *FlowNode);
+			const FFlowNodeIndexRecord* OldRecord = OldRecords ? OldRecords->Find(FlowNode->GetGuid()) : nullptr;
+
+			if (OldRecord && OldRecord->ContentHash == ContentHash)
+			{
+				NewRecords.Add(FlowNode->GetGuid(), *OldRecord);
+			}
+			else
+			{
+				FFlowNodeIndexRecord& NewRecord = NewRecords.Add(FlowNode->GetGuid());
+				NewRecord.ContentHash = ContentHash;
+				CollectRecord(*FlowGraphNode, *FlowNode, NewRecord);
+			}
+		}
+	}
+
+	FWriteScopeLock WriteLock(Lock);
+
+	if (OldRecords)
+	{
+		for (const TPair<FGuid, FFlowNodeIndexRecord>& Record : *OldRecords)
+		{
+			RemoveReferences(AssetPath, Record.Value);
+		}
+	}
+
+	for (const TPair<FGuid, FFlowNodeIndexRecord>& Record : NewRecords)
+	{
+		AddReferences(AssetPath, Record.Key, Record.Value);
+	}
+
+	return IndexedAssets.Add(AssetPath, MoveTemp(NewRecords));
+}
+
+void FFlowNodeSearchIndex::RemoveAsset(const FSoftObjectPath& AssetPath)
+{
+	check(IsInGameThread());
+
+	PendingLoads.Remove(AssetPath);
+
+	if (const TMap<FGuid, FFlowNodeIndexRecord>* Records = IndexedAssets.Find(AssetPath))
+	{
+		FWriteScopeLock WriteLock(Lock);
+
+		for (const TPair<FGuid, FFlowNodeIndexRecord>& Record : *Records)
+		{
+			RemoveReferences(AssetPath, Record.Value);
+		}
+		IndexedAssets.Remove(AssetPath);
+	}
+}
+
+void FFlowNodeSearchIndex::IndexAssets(const TArray<FAssetData>& AssetDataList)
+{
+	check(IsInGameThread());
+
+	for (const FAssetData& AssetData : AssetDataList)
+	{
+		const FSoftObjectPath AssetPath = AssetData.GetSoftObjectPath();
+		if (IndexedAssets.Contains(AssetPath) || PendingLoads.Contains(AssetPath))
+		{
+			continue;
+		}
+
+		if (const UFlowAsset* LoadedAsset = Cast<UFlowAsset>(AssetPath.ResolveObject()))
+		{
+			UpdateAsset(*LoadedAsset);
+			continue;
+		}
+
+		// all requests are queued at once, async loading thread processes packages in parallel to the game thread
+		PendingLoads.Add(AssetPath);
+		LoadPackageAsync(AssetData.PackageName.ToString(), FLoadPackageAsyncDelegate::CreateLambda([this, AssetPath](const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result)
+		{
+			if (PendingLoads.Remove(AssetPath) > 0 && Result == EAsyncLoadingResult::Succeeded)
+			{
+				if (const UFlowAsset* FlowAsset = Cast<UFlowAsset>(AssetPath.ResolveObject()))
+				{
+					UpdateAsset(*FlowAsset);
+				}
+			}
+		}));
+	}
+}
+
+int32 FFlowNodeSearchIndex::GetNumIndexedAssets() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return IndexedAssets.Num();
+}
+
+TArray<FFlowNodeReference> FFlowNodeSearchIndex::FindNodesByClass(const UClass* NodeClass, const bool bIncludeSubclasses) const
+{
+	TArray<FFlowNodeReference> Result;
+	if (NodeClass == nullptr)
+	{
+		return Result;
+	}
+
+	const FName NodeClassPath(*NodeClass->GetPathName());
+
+	FReadScopeLock ReadLock(Lock);
+
+	for (const TPair<FName, FNodesByAsset>& ClassNodes : NodesByClass)
+	{
+		if (ClassNodes.Key != NodeClassPath)
+		{
+			// class objects aren't accessed under the lock, blueprint classes might be reinstanced on the game thread
+			const TArray<FName>* ClassHierarchy = bIncludeSubclasses ? ClassHierarchies.Find(ClassNodes.Key) : nullptr;
+			if (ClassHierarchy == nullptr || !ClassHierarchy->Contains(NodeClassPath))
+			{
+				continue;
+			}
+		}
+
+		for (const TPair<FSoftObjectPath, TArray<FGuid>>& AssetNodes : ClassNodes.Value)
+		{
+			AppendReferences(AssetNodes.Key, AssetNodes.Value, Result);
+		}
+	}
+
+	return Result;
+}
+
+TArray<FFlowNodeReference> FFlowNodeSearchIndex::FindNodesByTag(const FGameplayTag& Tag, const bool bExactMatch) const
+{
+	TArray<FFlowNodeReference> Result;
+	if (!Tag.IsValid())
+	{
+		return Result;
+	}
+
+	FReadScopeLock ReadLock(Lock);
+
+	for (const TPair<FGameplayTag, FNodesByAsset>& TagNodes : NodesByTag)
+	{
+		if (bExactMatch ? TagNodes.Key == Tag : TagNodes.Key.MatchesTag(Tag))
+		{
+			for (const TPair<FSoftObjectPath, TArray<FGuid>>& AssetNodes : TagNodes.Value)
+			{
+				AppendReferences(AssetNodes.Key, AssetNodes.Value, Result);
+			}
+		}
+	}
+
+	return Result;
+}
+
+TArray<FFlowNodeReference> FFlowNodeSearchIndex::FindSubGraphReferences(const FSoftObjectPath& FlowAssetPath) const
+{
+	TArray<FFlowNodeReference> Result;
+
+	FReadScopeLock ReadLock(Lock);
+
+	if (const FNodesByAsset* ReferencingNodes = SubGraphReferences.Find(FlowAssetPath))
+	{
+		for (const TPair<FSoftObjectPath, TArray<FGuid>>& AssetNodes : *ReferencingNodes)
+		{
+			AppendReferences(AssetNodes.Key, AssetNodes.Value, Result);
+		}
+	}
+
+	return Result;
+}
+
+uint64 FFlowNodeSearchIndex::CalcContentHash(const UFlowGraphNode& GraphNode, const UFlowNode& FlowNode)
+{
+	// node class is hashed, as records collected for another class would hold its tags and properties
+	const UClass* Classes[] = {GraphNode.GetClass(), FlowNode.GetClass()};
+	uint64 Hash = CityHash64(reinterpret_cast<const char*>(Classes), sizeof(Classes));
+
+	TArray<uint8> Bytes;
+	for (const UObject* Object : {static_cast<const UObject*>(&GraphNode), static_cast<const UObject*>(&FlowNode)})
+	{
+		Bytes.Reset();
+		FObjectWriter Writer(const_cast<UObject*>(Object), Bytes);
+		Hash = CityHash64WithSeed(reinterpret_cast<const char*>(Bytes.GetData()), Bytes.Num(), Hash);
+	}
+
+	return Hash;
+}
+
+void FFlowNodeSearchIndex::CollectRecord(const UFlowGraphNode& GraphNode, const UFlowNode& FlowNode, FFlowNodeIndexRecord& OutRecord)
+{
+	for (const UClass* Class = FlowNode.GetClass(); Class; Class = Class->GetSuperClass())
+	{
+		OutRecord.ClassHierarchy.Add(FName(*Class->GetPathName()));
+		if (Class == UFlowNode::StaticClass())
+		{
+			break;
+		}
+	}
+
+	for (TFieldIterator<FProperty> It(FlowNode.GetClass()); It; ++It)
+	{
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(*It))
+		{
+			if (StructProperty->Struct == FGameplayTag::StaticStruct())
+			{
+				const FGameplayTag& Tag = *StructProperty->ContainerPtrToValuePtr<FGameplayTag>(&FlowNode);
+				if (Tag.IsValid())
+				{
+					OutRecord.Tags.AddUnique(Tag);
+				}
+			}
+			else if (StructProperty->Struct == FGameplayTagContainer::StaticStruct())
+			{
+				for (const FGameplayTag& Tag : *StructProperty->ContainerPtrToValuePtr<FGameplayTagContainer>(&FlowNode))
+				{
+					OutRecord.Tags.AddUnique(Tag);
+				}
+			}
+		}
+		else if (const FSoftObjectProperty* SoftObjectProperty = CastField<FSoftObjectProperty>(*It))
+		{
+			if (SoftObjectProperty->PropertyClass && SoftObjectProperty->PropertyClass->IsChildOf(UFlowAsset::StaticClass()))
+			{
+				const FSoftObjectPtr FlowAssetPtr = SoftObjectProperty->GetPropertyValue_InContainer(&FlowNode);
+				if (!FlowAssetPtr.IsNull())
+				{
+					OutRecord.ReferencedFlowAssets.AddUnique(FlowAssetPtr.ToSoftObjectPath());
+				}
+			}
+		}
+	}
+
+	// text passed to Asset Search, variant of FBlueprintIndexer::IndexGraphs
+	OutRecord.Title = GraphNode.GetNodeTitle(ENodeTitleType::MenuTitle);
+
+	for (const UEdGraphPin* Pin : GraphNode.Pins)
+	{
+		if (Pin->Direction == EGPD_Input && Pin->LinkedTo.Num() == 0)
+		{
+			const FText PinText = Pin->GetDisplayName();
+			if (PinText.IsEmpty())
+			{
+				continue;
+			}
+
+			const FText PinValue = Pin->GetDefaultAsText();
+			if (PinValue.IsEmpty())
+			{
+				continue;
+			}
+
+			OutRecord.PinValues.Emplace(TEXT("[Pin] ") + *FTextInspector::GetSourceString(PinText), PinValue);
+		}
+	}
+
+	// This will collect any user exposed options for the node that are editable in the Details
+	FIndexerUtilities::IterateIndexableProperties(&GraphNode, [&OutRecord](const FProperty* Property, const FString& Value)
+	{
+		OutRecord.GraphNodeProperties.Emplace(Property->GetDisplayNameText().ToString(), Value);
+	});
+
+	OutRecord.FlowNodeFriendlyName = FString::Printf(TEXT("%s: %s"), *FlowNode.GetClass()->GetName(), *FlowNode.GetNodeDescription());
+	FIndexerUtilities::IterateIndexableProperties(&FlowNode, [&OutRecord](const FProperty* Property, const FString& Value)
+	{
+		OutRecord.FlowNodeProperties.Emplace(Property->GetDisplayNameText().ToString(), Value);
+	});
+}
+
+void FFlowNodeSearchIndex::AddReferences(const FSoftObjectPath& AssetPath, const FGuid& NodeGuid, const FFlowNodeIndexRecord& Record)
+{
+	NodesByClass.FindOrAdd(Record.GetNodeClassPath()).FindOrAdd(AssetPath).Add(NodeGuid);
+
+	// the latest record wins, blueprint might have been reparented
+	ClassHierarchies.Add(Record.GetNodeClassPath(), Record.ClassHierarchy);
+
+	for (const FGameplayTag& Tag : Record.Tags)
+	{
+		NodesByTag.FindOrAdd(Tag).FindOrAdd(AssetPath).Add(NodeGuid);
+	}
+
+	for (const FSoftObjectPath& FlowAssetPath : Record.ReferencedFlowAssets)
+	{
+		SubGraphReferences.FindOrAdd(FlowAssetPath).FindOrAdd(AssetPath).Add(NodeGuid);
+	}
+}
+
+void FFlowNodeSearchIndex::RemoveReferences(const FSoftObjectPath& AssetPath, const FFlowNodeIndexRecord& Record)
+{
+	auto RemoveFromBucket = [&AssetPath](auto& Buckets, const auto& Key)
+	{
+		if (FNodesByAsset* Bucket = Buckets.Find(Key))
+		{
+			Bucket->Remove(AssetPath);
+			if (Bucket->Num() == 0)
+			{
+				Buckets.Remove(Key);
+			}
+		}
+	};
+
+	RemoveFromBucket(NodesByClass, Record.GetNodeClassPath());
+	if (!NodesByClass.Contains(Record.GetNodeClassPath()))
+	{
+		ClassHierarchies.Remove(Record.GetNodeClassPath());
+	}
+
+	for (const FGameplayTag& Tag : Record.Tags)
+	{
+		RemoveFromBucket(NodesByTag, Tag);
+	}
+
+	for (const FSoftObjectPath& FlowAssetPath : Record.ReferencedFlowAssets)
+	{
+		RemoveFromBucket(SubGraphReferences, FlowAssetPath);
+	}
+}
+
+void FFlowNodeSearchIndex::OnAssetRemoved(const FAssetData& AssetData)
+{
+	RemoveAsset(AssetData.GetSoftObjectPath());
+}
+
+void FFlowNodeSearchIndex::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	// asset under the new path will be indexed again by Asset Search
+	RemoveAsset(FSoftObjectPath(OldObjectPath));
+}
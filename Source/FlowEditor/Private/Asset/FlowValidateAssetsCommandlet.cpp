@@ -0,0 +1,440 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Asset/FlowValidateAssetsCommandlet.h"
+#include "FlowEditorLogChannels.h"
+
+#include "FlowAsset.h"
+#include "FlowMessageLog.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "BuildSettings.h"
+#include "Dom/JsonObject.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/UObjectGlobals.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlowValidateAssetsCommandlet)
+
+namespace FlowValidateAssets
+{
+	// bump when the cache format changes, build changes are already included in asset hashes
+	constexpr int32 CacheVersion = 2;
+
+	static const TCHAR* LexSeverity(const EMessageSeverity::Type Severity)
+	{
+		switch (Severity)
+		{
+			case EMessageSeverity::Error:
+				return TEXT("Error");
+			case EMessageSeverity::PerformanceWarning:
+				return TEXT("PerformanceWarning");
+			case EMessageSeverity::Warning:
+				return TEXT("Warning");
+			default:
+				return TEXT("Info");
+		}
+	}
+
+	static TSharedRef<FJsonObject> MakeAssetReport(const FAssetData& AssetData, const TCHAR* Result)
+	{
+		TSharedRef<FJsonObject> AssetReport = MakeShared<FJsonObject>();
+		AssetReport->SetStringField(TEXT("Asset"), AssetData.GetSoftObjectPath().ToString());
+		AssetReport->SetStringField(TEXT("Result"), Result);
+		return AssetReport;
+	}
+
+	static TArray<TSharedPtr<FJsonValue>> MakeMessageReports(const TArray<TPair<FString, FString>>& Messages)
+	{
+		TArray<TSharedPtr<FJsonValue>> MessageReports;
+		MessageReports.Reserve(Messages.Num());
+		for (const TPair<FString, FString>& Message : Messages)
+		{
+			TSharedRef<FJsonObject> MessageReport = MakeShared<FJsonObject>();
+			MessageReport->SetStringField(TEXT("Severity"), Message.Key);
+			MessageReport->SetStringField(TEXT("Message"), Message.Value);
+			MessageReports.Add(MakeShared<FJsonValueObject>(MessageReport));
+		}
+		return MessageReports;
+	}
+}
+
+UFlowValidateAssetsCommandlet::UFlowValidateAssetsCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 UFlowValidateAssetsCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamValues;
+	ParseCommandLine(*Params, Tokens, Switches, ParamValues);
+
+	const bool bFullValidation = Switches.Contains(TEXT("Full"));
+	const FString* PathParam = ParamValues.Find(TEXT("Path"));
+	const FString* ReportParam = ParamValues.Find(TEXT("Report"));
+	const FString* BatchSizeParam = ParamValues.Find(TEXT("BatchSize"));
+	const FString ReportFilename = ReportParam ? *ReportParam : FPaths::ProjectSavedDir() / TEXT("Flow") / TEXT("ValidationReport.json");
+	const int32 BatchSize = BatchSizeParam ? FMath::Max(1, FCString::Atoi(**BatchSizeParam)) : 64;
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UFlowAsset::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	if (PathParam)
+	{
+		Filter.PackagePaths.Add(**PathParam);
+		Filter.bRecursivePaths = true;
+	}
+
+	TArray<FAssetData> AssetDataList;
+	AssetRegistry.GetAssets(Filter, AssetDataList);
+	UE_LOG(LogFlowEditor, Display, TEXT("FlowValidateAssets: found %d Flow Assets"), AssetDataList.Num());
+
+	const TArray<FString> PackageHashes = CalcPackageHashes(AssetDataList);
+	TMap<FString, FFlowValidationCacheEntry> ValidatedAssets = bFullValidation ? TMap<FString, FFlowValidationCacheEntry>() : LoadCache();
+
+	// drop assets deleted or renamed since the last run, assets outside of the validated path weren't scanned and stay cached
+	{
+		TSet<FString> FoundAssets;
+		FoundAssets.Reserve(AssetDataList.Num());
+		for (const FAssetData& AssetData : AssetDataList)
+		{
+			FoundAssets.Add(AssetData.GetSoftObjectPath().ToString());
+		}
+
+		for (auto It = ValidatedAssets.CreateIterator(); It; ++It)
+		{
+			if (!FoundAssets.Contains(It.Key()) && (PathParam == nullptr || FPaths::IsUnderDirectory(It.Key(), *PathParam)))
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	TArray<TSharedPtr<FJsonValue>> AssetReports;
+	AssetReports.Reserve(AssetDataList.Num());
+
+	TArray<int32> PendingAssets;
+	int32 NumSkipped = 0;
+	for (int32 Index = 0; Index < AssetDataList.Num(); Index++)
+	{
+		const FString AssetPath = AssetDataList[Index].GetSoftObjectPath().ToString();
+		const FFlowValidationCacheEntry* CacheEntry = ValidatedAssets.Find(AssetPath);
+		if (CacheEntry && !PackageHashes[Index].IsEmpty() && CacheEntry->Hash == PackageHashes[Index])
+		{
+			TSharedRef<FJsonObject> AssetReport = FlowValidateAssets::MakeAssetReport(AssetDataList[Index], TEXT("Skipped"));
+			AssetReport->SetArrayField(TEXT("Messages"), FlowValidateAssets::MakeMessageReports(CacheEntry->Messages));
+			AssetReports.Add(MakeShared<FJsonValueObject>(AssetReport));
+			NumSkipped++;
+		}
+		else
+		{
+			ValidatedAssets.Remove(AssetPath);
+			PendingAssets.Add(Index);
+		}
+	}
+
+	int32 NumInvalid = 0;
+	int32 NumFailed = 0;
+	{
+		// node class rules are the same for every asset of the given class
+		FFlowNodeClassRulesCacheScope ClassRulesCache;
+
+		for (int32 BatchStart = 0; BatchStart < PendingAssets.Num(); BatchStart += BatchSize)
+		{
+			const int32 BatchEnd = FMath::Min(BatchStart + BatchSize, PendingAssets.Num());
+
+			// async loading thread processes the whole batch in parallel, validation itself runs user code and stays on the game thread
+			for (int32 PendingIndex = BatchStart; PendingIndex < BatchEnd; PendingIndex++)
+			{
+				LoadPackageAsync(AssetDataList[PendingAssets[PendingIndex]].PackageName.ToString());
+			}
+			FlushAsyncLoading();
+
+			for (int32 PendingIndex = BatchStart; PendingIndex < BatchEnd; PendingIndex++)
+			{
+				const int32 AssetIndex = PendingAssets[PendingIndex];
+				const FAssetData& AssetData = AssetDataList[AssetIndex];
+
+				UFlowAsset* FlowAsset = Cast<UFlowAsset>(AssetData.GetSoftObjectPath().ResolveObject());
+				if (FlowAsset == nullptr)
+				{
+					UE_LOG(LogFlowEditor, Error, TEXT("FlowValidateAssets: failed to load %s"), *AssetData.GetSoftObjectPath().ToString());
+					AssetReports.Add(MakeShared<FJsonValueObject>(FlowValidateAssets::MakeAssetReport(AssetData, TEXT("LoadFailed"))));
+					NumFailed++;
+					continue;
+				}
+
+				FFlowMessageLog MessageLog;
+				const EDataValidationResult Result = FlowAsset->ValidateAsset(MessageLog);
+
+				TArray<TPair<FString, FString>> Messages;
+				Messages.Reserve(MessageLog.Messages.Num());
+				for (const TSharedRef<FTokenizedMessage>& Message : MessageLog.Messages)
+				{
+					const FString MessageText = Message->ToText().ToString();
+					Messages.Emplace(FlowValidateAssets::LexSeverity(Message->GetSeverity()), MessageText);
+
+					if (Message->GetSeverity() == EMessageSeverity::Error)
+					{
+						UE_LOG(LogFlowEditor, Error, TEXT("%s: %s"), *AssetData.GetSoftObjectPath().ToString(), *MessageText);
+					}
+					else
+					{
+						UE_LOG(LogFlowEditor, Warning, TEXT("%s: %s"), *AssetData.GetSoftObjectPath().ToString(), *MessageText);
+					}
+				}
+
+				TSharedRef<FJsonObject> AssetReport = FlowValidateAssets::MakeAssetReport(AssetData, Result == EDataValidationResult::Invalid ? TEXT("Invalid") : TEXT("Valid"));
+				AssetReport->SetArrayField(TEXT("Messages"), FlowValidateAssets::MakeMessageReports(Messages));
+				AssetReports.Add(MakeShared<FJsonValueObject>(AssetReport));
+
+				if (Result == EDataValidationResult::Invalid)
+				{
+					NumInvalid++;
+				}
+				else if (!PackageHashes[AssetIndex].IsEmpty())
+				{
+					FFlowValidationCacheEntry& CacheEntry = ValidatedAssets.Add(AssetData.GetSoftObjectPath().ToString());
+					CacheEntry.Hash = PackageHashes[AssetIndex];
+					CacheEntry.Messages = MoveTemp(Messages);
+				}
+			}
+
+			// keep memory bounded on large projects
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+			UE_LOG(LogFlowEditor, Display, TEXT("FlowValidateAssets: validated %d of %d assets"), BatchEnd, PendingAssets.Num());
+		}
+	}
+
+	SaveCache(ValidatedAssets);
+
+	const TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetNumberField(TEXT("Total"), AssetDataList.Num());
+	Report->SetNumberField(TEXT("Validated"), PendingAssets.Num());
+	Report->SetNumberField(TEXT("Skipped"), NumSkipped);
+	Report->SetNumberField(TEXT("Invalid"), NumInvalid);
+	Report->SetNumberField(TEXT("LoadFailed"), NumFailed);
+	Report->SetArrayField(TEXT("Assets"), AssetReports);
+
+	FString ReportString;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ReportString);
+	FJsonSerializer::Serialize(Report, Writer);
+	if (!FFileHelper::SaveStringToFile(ReportString, *ReportFilename))
+	{
+		UE_LOG(LogFlowEditor, Error, TEXT("FlowValidateAssets: failed to write report %s"), *ReportFilename);
+	}
+
+	UE_LOG(LogFlowEditor, Display, TEXT("FlowValidateAssets: %d assets validated, %d skipped as unchanged, %d invalid, %d failed to load. Report: %s"),
+		PendingAssets.Num(), NumSkipped, NumInvalid, NumFailed, *ReportFilename);
+
+	return (NumInvalid > 0 || NumFailed > 0) ? 1 : 0;
+}
+
+FString UFlowValidateAssetsCommandlet::GetCacheFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("Flow") / TEXT("ValidationCache.json");
+}
+
+TArray<FString> UFlowValidateAssetsCommandlet::CalcPackageHashes(const TArray<FAssetData>& AssetDataList)
+{
+	const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+
+	// node blueprints and sub-graphs are shared by many assets, every package is hashed once
+	TArray<FName> UniquePackages;
+	TMap<FName, int32> PackageIndices;
+	TArray<TArray<int32>> AssetPackages;
+	AssetPackages.SetNum(AssetDataList.Num());
+
+	// direct dependencies of every visited package, many assets walk the same dependency chains
+	TMap<FName, TArray<FName>> DirectDependencies;
+	auto GetDirectDependencies = [&AssetRegistry, &DirectDependencies](const FName& PackageName) -> const TArray<FName>&
+	{
+		if (const TArray<FName>* Dependencies = DirectDependencies.Find(PackageName))
+		{
+			return *Dependencies;
+		}
+
+		TArray<FName> Dependencies;
+		AssetRegistry.GetDependencies(PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+		Dependencies.RemoveAll([](const FName& Dependency)
+		{
+			return FPackageName::IsScriptPackage(Dependency.ToString());
+		});
+		return DirectDependencies.Add(PackageName, MoveTemp(Dependencies));
+	};
+
+	for (int32 AssetIndex = 0; AssetIndex < AssetDataList.Num(); AssetIndex++)
+	{
+		const FName AssetPackage = AssetDataList[AssetIndex].PackageName;
+
+		// i.e. a node blueprint might change the parent class defining validation of the node
+		TSet<FName> VisitedPackages = {AssetPackage};
+		TArray<FName> PackagesToVisit = {AssetPackage};
+		while (PackagesToVisit.Num() > 0)
+		{
+			const FName PackageName = PackagesToVisit.Pop();
+			for (const FName& Dependency : GetDirectDependencies(PackageName))
+			{
+				bool bAlreadyVisited = false;
+				VisitedPackages.Add(Dependency, &bAlreadyVisited);
+				if (!bAlreadyVisited)
+				{
+					PackagesToVisit.Add(Dependency);
+				}
+			}
+		}
+		VisitedPackages.Remove(AssetPackage);
+
+		TArray<FName> Packages = VisitedPackages.Array();
+		Packages.Sort(FNameLexicalLess());
+		Packages.Insert(AssetPackage, 0);
+
+		for (const FName& PackageName : Packages)
+		{
+			const int32* PackageIndex = PackageIndices.Find(PackageName);
+			if (PackageIndex == nullptr)
+			{
+				PackageIndex = &PackageIndices.Add(PackageName, UniquePackages.Add(PackageName));
+			}
+			AssetPackages[AssetIndex].Add(*PackageIndex);
+		}
+	}
+
+	TArray<FString> Filenames;
+	Filenames.SetNum(UniquePackages.Num());
+	for (int32 Index = 0; Index < UniquePackages.Num(); Index++)
+	{
+		FPackageName::TryConvertLongPackageNameToFilename(UniquePackages[Index].ToString(), Filenames[Index], FPackageName::GetAssetPackageExtension());
+	}
+
+	// reading files is the expensive part
+	TArray<FMD5Hash> FileHashes;
+	FileHashes.SetNum(UniquePackages.Num());
+	ParallelFor(UniquePackages.Num(), [&Filenames, &FileHashes](const int32 Index)
+	{
+		if (!Filenames[Index].IsEmpty())
+		{
+			FileHashes[Index] = FMD5Hash::HashFile(*Filenames[Index]);
+		}
+	});
+
+	// validation rules are defined in code, so a different build invalidates results of previous validation
+	const FString BuildId = FString::Printf(TEXT("%s %s %d"), *FEngineVersion::Current().ToString(), BuildSettings::GetBuildVersion(), BuildSettings::GetCurrentChangelist());
+
+	TArray<FString> Result;
+	Result.SetNum(AssetDataList.Num());
+	for (int32 AssetIndex = 0; AssetIndex < AssetDataList.Num(); AssetIndex++)
+	{
+		// asset without a file on disk is never skipped, missing dependencies still contribute their names
+		if (!FileHashes[AssetPackages[AssetIndex][0]].IsValid())
+		{
+			continue;
+		}
+
+		FMD5 Md5;
+		Md5.Update(reinterpret_cast<const uint8*>(*BuildId), BuildId.Len() * sizeof(TCHAR));
+
+		for (const int32 PackageIndex : AssetPackages[AssetIndex])
+		{
+			const FString PackageName = UniquePackages[PackageIndex].ToString();
+			Md5.Update(reinterpret_cast<const uint8*>(*PackageName), PackageName.Len() * sizeof(TCHAR));
+
+			const FMD5Hash& FileHash = FileHashes[PackageIndex];
+			if (FileHash.IsValid())
+			{
+				Md5.Update(FileHash.GetBytes(), FileHash.GetSize());
+			}
+		}
+
+		FMD5Hash AssetHash;
+		AssetHash.Set(Md5);
+		Result[AssetIndex] = LexToString(AssetHash);
+	}
+
+	return Result;
+}
+
+TMap<FString, FFlowValidationCacheEntry> UFlowValidateAssetsCommandlet::LoadCache()
+{
+	TMap<FString, FFlowValidationCacheEntry> ValidatedAssets;
+
+	FString CacheString;
+	if (!FFileHelper::LoadFileToString(CacheString, *GetCacheFilename()))
+	{
+		return ValidatedAssets;
+	}
+
+	TSharedPtr<FJsonObject> Cache;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(CacheString);
+	if (!FJsonSerializer::Deserialize(Reader, Cache) || !Cache.IsValid() || Cache->GetIntegerField(TEXT("Version")) != FlowValidateAssets::CacheVersion)
+	{
+		return ValidatedAssets;
+	}
+
+	const TSharedPtr<FJsonObject>* ValidAssets = nullptr;
+	if (Cache->TryGetObjectField(TEXT("ValidAssets"), ValidAssets))
+	{
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& ValidAsset : (*ValidAssets)->Values)
+		{
+			const TSharedPtr<FJsonObject>* Entry = nullptr;
+			if (!ValidAsset.Value->TryGetObject(Entry))
+			{
+				continue;
+			}
+
+			FFlowValidationCacheEntry& CacheEntry = ValidatedAssets.Add(ValidAsset.Key);
+			CacheEntry.Hash = (*Entry)->GetStringField(TEXT("Hash"));
+
+			const TArray<TSharedPtr<FJsonValue>>* Messages = nullptr;
+			if ((*Entry)->TryGetArrayField(TEXT("Messages"), Messages))
+			{
+				for (const TSharedPtr<FJsonValue>& Message : *Messages)
+				{
+					const TSharedPtr<FJsonObject>* MessageObject = nullptr;
+					if (Message->TryGetObject(MessageObject))
+					{
+						CacheEntry.Messages.Emplace((*MessageObject)->GetStringField(TEXT("Severity")), (*MessageObject)->GetStringField(TEXT("Message")));
+					}
+				}
+			}
+		}
+	}
+
+	return ValidatedAssets;
+}
+
+void UFlowValidateAssetsCommandlet::SaveCache(const TMap<FString, FFlowValidationCacheEntry>& ValidatedAssets)
+{
+	const TSharedRef<FJsonObject> ValidAssets = MakeShared<FJsonObject>();
+	for (const TPair<FString, FFlowValidationCacheEntry>& ValidatedAsset : ValidatedAssets)
+	{
+		const TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+		Entry->SetStringField(TEXT("Hash"), ValidatedAsset.Value.Hash);
+		Entry->SetArrayField(TEXT("Messages"), FlowValidateAssets::MakeMessageReports(ValidatedAsset.Value.Messages));
+		ValidAssets->SetObjectField(ValidatedAsset.Key, Entry);
+	}
+
+	const TSharedRef<FJsonObject> Cache = MakeShared<FJsonObject>();
+	Cache->SetNumberField(TEXT("Version"), FlowValidateAssets::CacheVersion);
+	Cache->SetObjectField(TEXT("ValidAssets"), ValidAssets);
+
+	FString CacheString;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&CacheString);
+	FJsonSerializer::Serialize(Cache, Writer);
+	FFileHelper::SaveStringToFile(CacheString, *GetCacheFilename());
+}
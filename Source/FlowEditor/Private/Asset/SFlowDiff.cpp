@@ -317,6 +317,36 @@ void SFlowDiff::OnGraphChanged(const FFlowGraphToDiff* Diff)
 	}
 }
 
+void SFlowDiff::InsertGraphDifference(const int32 Index, const TSharedPtr<FBlueprintDifferenceTreeEntry>& Entry)
+{
+	RealDifferences.Insert(Entry, Index);
+}
+
+void SFlowDiff::RefreshDifferencesTree() const
+{
+	DifferencesTreeView->RebuildList();
+}
+
+void SFlowDiff::OnGraphDiffFinished(const FFlowGraphToDiff* Diff)
+{
+	const TSharedPtr<SGraphEditor> OldGraphEditor = PanelOld.GraphEditor.Pin();
+	const TSharedPtr<SGraphEditor> NewGraphEditor = PanelNew.GraphEditor.Pin();
+
+	const bool bDisplaysGraph = (OldGraphEditor.IsValid() && Diff->GetGraphOld() && OldGraphEditor->GetCurrentGraph() == Diff->GetGraphOld())
+		|| (NewGraphEditor.IsValid() && Diff->GetGraphNew() && NewGraphEditor->GetCurrentGraph() == Diff->GetGraphNew());
+
+	// graph editors highlight only differences found before their node widgets were created
+	if (bDisplaysGraph)
+	{
+		PanelOld.GraphEditor.Reset();
+		PanelNew.GraphEditor.Reset();
+
+		UEdGraph* Graph = Diff->GetGraphOld() ? Diff->GetGraphOld() : Diff->GetGraphNew();
+		GenerateGraphPanels(FGraphDiffControl::GetGraphPath(Graph));
+		ResetGraphEditors();
+	}
+}
+
 TSharedRef<SWidget> SFlowDiff::DefaultEmptyPanel()
 {
 	return SNew(SHorizontalBox)
@@ -618,11 +648,14 @@ FFlowDiffPanel& SFlowDiff::GetDiffPanelForNode(const UEdGraphNode& Node)
 void SFlowDiff::HandleGraphChanged(const FString& GraphPath)
 {
 	SetCurrentMode(GraphMode);
+	GenerateGraphPanels(GraphPath);
+}
 
+void SFlowDiff::GenerateGraphPanels(const FString& GraphPath)
+{
 	UEdGraph* GraphOld = nullptr;
 	UEdGraph* GraphNew = nullptr;
 	TSharedPtr<TArray<FDiffSingleResult>> DiffResults;
-	int32 RealDifferencesStartIndex = INDEX_NONE;
 	{
 		UEdGraph* NewGraph = GraphToDiff->GetGraphNew();
 		UEdGraph* OldGraph = GraphToDiff->GetGraphOld();
@@ -632,13 +665,14 @@ void SFlowDiff::HandleGraphChanged(const FString& GraphPath)
 			GraphNew = NewGraph;
 			GraphOld = OldGraph;
 			DiffResults = GraphToDiff->FoundDiffs;
-			RealDifferencesStartIndex = GraphToDiff->RealDifferencesStartIndex;
 		}
 	}
 
+	// differences are still streamed in while the panel is displayed, read the start index on demand
 	const TAttribute<int32> FocusedDiffResult = TAttribute<int32>::CreateLambda(
-		[this, RealDifferencesStartIndex]()
+		[this]()
 		{
+			const int32 RealDifferencesStartIndex = GraphToDiff.IsValid() ? GraphToDiff->RealDifferencesStartIndex : INDEX_NONE;
 			int32 FocusedDiffResult = INDEX_NONE;
 			if (RealDifferencesStartIndex != INDEX_NONE)
 			{
@@ -6,6 +6,7 @@
 #include "Asset/AssetTypeActions_FlowAsset.h"
 #include "Asset/FlowAssetEditor.h"
 #include "Asset/FlowAssetIndexer.h"
+#include "Asset/FlowNodeSearchIndex.h"
 #include "Graph/FlowGraphConnectionDrawingPolicy.h"
 #include "Graph/FlowGraphSettings.h"
 #include "Utils/SLevelEditorFlow.h"
@@ -74,6 +75,7 @@ void FFlowEditorModule::StartupModule()
 	RegisterDetailCustomizations();
 
 	// register asset indexers
+	FFlowNodeSearchIndex::Get().Initialize();
 	if (FModuleManager::Get().IsModuleLoaded(AssetSearchModuleName))
 	{
 		RegisterAssetIndexers();
@@ -94,6 +96,7 @@ void FFlowEditorModule::ShutdownModule()
 	SequencerModule.UnRegisterTrackEditor(FlowTrackCreateEditorHandle);
 
 	FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+	FFlowNodeSearchIndex::Get().Deinitialize();
 }
 
 void FFlowEditorModule::RegisterAssets()
@@ -19,7 +19,93 @@ void FFlowGraphInterface::OnInputTriggered(UEdGraphNode* GraphNode, const int32
 
 void FFlowGraphInterface::OnOutputTriggered(UEdGraphNode* GraphNode, const int32 Index) const
 {
-	CastChecked<UFlowGraphNode>(GraphNode)->OnOutputTriggered(Index);
+	UFlowGraphNode* FlowGraphNode = CastChecked<UFlowGraphNode>(GraphNode);
+	FlowGraphNode->OnOutputTriggered(Index);
+
+	CastChecked<UFlowGraph>(GraphNode->GetGraph())->GetWireRecords().OnOutputTriggered(*FlowGraphNode, Index);
+}
+
+bool FFlowGraphInterface::HasBreakpoints(const UFlowAsset& TemplateAsset) const
+{
+	if (const UEdGraph* Graph = TemplateAsset.GetGraph())
+	{
+		for (const UEdGraphNode* Node : Graph->Nodes)
+		{
+			const UFlowGraphNode* FlowGraphNode = Cast<UFlowGraphNode>(Node);
+			if (FlowGraphNode && FlowGraphNode->HasBreakpoints())
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+void FFlowGraphWireRecords::Update(const UFlowAsset* InspectedInstance)
+{
+	if (bDirty || Instance.Get() != InspectedInstance)
+	{
+		Rebuild(InspectedInstance);
+	}
+	else if (InspectedInstance)
+	{
+		// instance has been restarted, its records were reset
+		if (InspectedInstance->GetRecordedNodes().Num() < NumRecordedNodes)
+		{
+			Rebuild(InspectedInstance);
+		}
+		else
+		{
+			NumRecordedNodes = InspectedInstance->GetRecordedNodes().Num();
+		}
+	}
+}
+
+void FFlowGraphWireRecords::OnOutputTriggered(const UFlowGraphNode& GraphNode, const int32 Index)
+{
+	// uninspected instances report triggered pins if the graph has breakpoints, only the inspected instance is displayed
+	const UFlowAsset* InspectedInstance = Instance.Get();
+	if (bDirty || InspectedInstance == nullptr || !GraphNode.OutputPins.IsValidIndex(Index))
+	{
+		return;
+	}
+
+	const UEdGraphPin* OutputPin = GraphNode.OutputPins[Index];
+	if (const UFlowNode* NodeInstance = InspectedInstance->FindInstancedNode(GraphNode.NodeGuid))
+	{
+		if (const FPinRecord* Record = NodeInstance->FindLastPinRecord(OutputPin->PinName, EGPD_Output))
+		{
+			OutputActivations.Add(OutputPin, Record->Time);
+		}
+	}
+}
+
+void FFlowGraphWireRecords::Rebuild(const UFlowAsset* InspectedInstance)
+{
+	OutputActivations.Reset();
+	Instance = InspectedInstance;
+	NumRecordedNodes = 0;
+	bDirty = false;
+
+	if (InspectedInstance)
+	{
+		for (const UFlowNode* Node : InspectedInstance->GetRecordedNodes())
+		{
+			if (const UFlowGraphNode* GraphNode = Cast<UFlowGraphNode>(Node->GetGraphNode()))
+			{
+				for (const TPair<uint8, FPinRecord>& Record : Node->GetWireRecords())
+				{
+					if (GraphNode->OutputPins.IsValidIndex(Record.Key))
+					{
+						OutputActivations.Add(GraphNode->OutputPins[Record.Key], Record.Value.Time);
+					}
+				}
+			}
+		}
+
+		NumRecordedNodes = InspectedInstance->GetRecordedNodes().Num();
+	}
 }
 
 UFlowGraph::UFlowGraph(const FObjectInitializer& ObjectInitializer)
@@ -81,6 +167,7 @@ void UFlowGraph::RefreshGraph()
 void UFlowGraph::NotifyGraphChanged()
 {
 	GetFlowAsset()->HarvestNodeConnections();
+	WireRecords.MarkDirty();
 
 	Super::NotifyGraphChanged();
 }
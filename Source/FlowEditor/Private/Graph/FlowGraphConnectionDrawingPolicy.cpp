@@ -33,6 +33,8 @@ FConnectionDrawingPolicy* FFlowGraphConnectionDrawingPolicyFactory::CreateConnec
 FFlowGraphConnectionDrawingPolicy::FFlowGraphConnectionDrawingPolicy(int32 InBackLayerID, int32 InFrontLayerID, float ZoomFactor, const FSlateRect& InClippingRect, FSlateWindowElementList& InDrawElements, UEdGraph* InGraphObj)
 	: FConnectionDrawingPolicy(InBackLayerID, InFrontLayerID, ZoomFactor, InClippingRect, InDrawElements)
 	, GraphObj(InGraphObj)
+	, WireRecords(nullptr)
+	, CurrentTime(0.0)
 {
 	// Cache off the editor options
 	RecentWireDuration = UFlowGraphSettings::Get()->RecentWireDuration;
@@ -54,32 +56,12 @@ FFlowGraphConnectionDrawingPolicy::FFlowGraphConnectionDrawingPolicy(int32 InBac
 
 void FFlowGraphConnectionDrawingPolicy::BuildPaths()
 {
-	if (const UFlowAsset* FlowInstance = CastChecked<UFlowGraph>(GraphObj)->GetFlowAsset()->GetInspectedInstance())
-	{
-		const double CurrentTime = FApp::GetCurrentTime();
-
-		for (const UFlowNode* Node : FlowInstance->GetRecordedNodes())
-		{
-			const UFlowGraphNode* FlowGraphNode = Cast<UFlowGraphNode>(Node->GetGraphNode());
+	// records are updated when pins are triggered, only rebuilt after changing the inspected instance
+	UFlowGraph* FlowGraph = CastChecked<UFlowGraph>(GraphObj);
+	FlowGraph->GetWireRecords().Update(FlowGraph->GetFlowAsset()->GetInspectedInstance());
 
-			for (const TPair<uint8, FPinRecord>& Record : Node->GetWireRecords())
-			{
-				if (UEdGraphPin* OutputPin = FlowGraphNode->OutputPins[Record.Key])
-				{
-					// check if Output pin is connected to anything
-					if (OutputPin->LinkedTo.Num() > 0)
-					{
-						RecordedPaths.Emplace(OutputPin, OutputPin->LinkedTo[0]);
-
-						if (CurrentTime < Record.Value.Time + RecentWireDuration)
-						{
-							RecentPaths.Emplace(OutputPin, OutputPin->LinkedTo[0]);
-						}
-					}
-				}
-			}
-		}
-	}
+	WireRecords = &FlowGraph->GetWireRecords();
+	CurrentTime = FApp::GetCurrentTime();
 
 	if (GraphObj && (UFlowGraphEditorSettings::Get()->bHighlightInputWiresOfSelectedNodes || UFlowGraphEditorSettings::Get()->bHighlightOutputWiresOfSelectedNodes))
 	{
@@ -153,18 +135,19 @@ void FFlowGraphConnectionDrawingPolicy::DetermineWiringStyle(UEdGraphPin* Output
 				return;
 			}
 
-			// recent paths
-			if (RecentPaths.Contains(OutputPin) && RecentPaths[OutputPin] == InputPin)
+			const double* ActivationTime = WireRecords ? WireRecords->FindActivationTime(OutputPin) : nullptr;
+			if (ActivationTime && OutputPin->LinkedTo.Num() > 0 && OutputPin->LinkedTo[0] == InputPin)
 			{
-				Params.WireColor = RecentColor;
-				Params.WireThickness = RecentWireThickness;
-				Params.bDrawBubbles = true;
-				return;
-			}
+				// recent paths
+				if (CurrentTime < *ActivationTime + RecentWireDuration)
+				{
+					Params.WireColor = RecentColor;
+					Params.WireThickness = RecentWireThickness;
+					Params.bDrawBubbles = true;
+					return;
+				}
 
-			// all paths, showing graph history
-			if (RecordedPaths.Contains(OutputPin) && RecordedPaths[OutputPin] == InputPin)
-			{
+				// all paths, showing graph history
 				Params.WireColor = RecordedColor;
 				Params.WireThickness = RecordedWireThickness;
 				Params.bDrawBubbles = false;
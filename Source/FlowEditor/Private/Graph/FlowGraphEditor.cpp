@@ -773,6 +773,8 @@ void SFlowGraphEditor::OnAddBreakpoint() const
 	{
 		SelectedNode->NodeBreakpoint.AllowTrait();
 	}
+
+	RefreshInstanceObservers();
 }
 
 void SFlowGraphEditor::OnAddPinBreakpoint()
@@ -784,6 +786,8 @@ void SFlowGraphEditor::OnAddPinBreakpoint()
 			GraphNode->PinBreakpoints.Add(Pin, FFlowPinTrait(true));
 		}
 	}
+
+	RefreshInstanceObservers();
 }
 
 bool SFlowGraphEditor::CanAddBreakpoint() const
@@ -815,6 +819,8 @@ void SFlowGraphEditor::OnRemoveBreakpoint() const
 	{
 		SelectedNode->NodeBreakpoint.DisallowTrait();
 	}
+
+	RefreshInstanceObservers();
 }
 
 void SFlowGraphEditor::OnRemovePinBreakpoint()
@@ -826,6 +832,8 @@ void SFlowGraphEditor::OnRemovePinBreakpoint()
 			GraphNode->PinBreakpoints.Remove(Pin);
 		}
 	}
+
+	RefreshInstanceObservers();
 }
 
 bool SFlowGraphEditor::CanRemoveBreakpoint() const
@@ -857,6 +865,8 @@ void SFlowGraphEditor::OnEnableBreakpoint() const
 	{
 		SelectedNode->NodeBreakpoint.EnableTrait();
 	}
+
+	RefreshInstanceObservers();
 }
 
 void SFlowGraphEditor::OnEnablePinBreakpoint()
@@ -868,6 +878,8 @@ void SFlowGraphEditor::OnEnablePinBreakpoint()
 			GraphNode->PinBreakpoints[Pin].EnableTrait();
 		}
 	}
+
+	RefreshInstanceObservers();
 }
 
 bool SFlowGraphEditor::CanEnableBreakpoint()
@@ -907,6 +919,8 @@ void SFlowGraphEditor::OnDisableBreakpoint() const
 	{
 		SelectedNode->NodeBreakpoint.DisableTrait();
 	}
+
+	RefreshInstanceObservers();
 }
 
 void SFlowGraphEditor::OnDisablePinBreakpoint()
@@ -918,6 +932,8 @@ void SFlowGraphEditor::OnDisablePinBreakpoint()
 			GraphNode->PinBreakpoints[Pin].DisableTrait();
 		}
 	}
+
+	RefreshInstanceObservers();
 }
 
 bool SFlowGraphEditor::CanDisableBreakpoint() const
@@ -949,6 +965,8 @@ void SFlowGraphEditor::OnToggleBreakpoint() const
 	{
 		SelectedNode->NodeBreakpoint.ToggleTrait();
 	}
+
+	RefreshInstanceObservers();
 }
 
 void SFlowGraphEditor::OnTogglePinBreakpoint()
@@ -961,6 +979,16 @@ void SFlowGraphEditor::OnTogglePinBreakpoint()
 			GraphNode->PinBreakpoints[Pin].ToggleTrait();
 		}
 	}
+
+	RefreshInstanceObservers();
+}
+
+void SFlowGraphEditor::RefreshInstanceObservers() const
+{
+	if (FlowAsset.IsValid())
+	{
+		FlowAsset->RefreshInstanceObservers();
+	}
 }
 
 bool SFlowGraphEditor::CanToggleBreakpoint() const
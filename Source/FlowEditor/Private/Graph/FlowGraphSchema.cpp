@@ -46,6 +46,7 @@ void UFlowGraphSchema::SubscribeToAssetChanges()
 	AssetRegistry.Get().OnFilesLoaded().AddStatic(&UFlowGraphSchema::GatherNodes);
 	AssetRegistry.Get().OnAssetAdded().AddStatic(&UFlowGraphSchema::OnAssetAdded);
 	AssetRegistry.Get().OnAssetRemoved().AddStatic(&UFlowGraphSchema::OnAssetRemoved);
+	AssetRegistry.Get().OnAssetUpdated().AddStatic(&UFlowGraphSchema::OnAssetUpdated);
 
 	FCoreUObjectDelegates::ReloadCompleteDelegate.AddStatic(&UFlowGraphSchema::OnHotReload);
 
@@ -275,7 +276,15 @@ TArray<TSharedPtr<FString>> UFlowGraphSchema::GetFlowNodeCategories()
 
 	for (const TPair<FName, FAssetData>& AssetData : BlueprintFlowNodes)
 	{
-		if (const UBlueprint* Blueprint = GetPlaceableNodeBlueprint(AssetData.Value))
+		FFlowNodeBlueprintTags NodeTags;
+		if (ReadBlueprintNodeTags(AssetData.Value, NodeTags))
+		{
+			if (NodeTags.bPlaceable)
+			{
+				UnsortedCategories.Emplace(NodeTags.Category);
+			}
+		}
+		else if (const UBlueprint* Blueprint = GetPlaceableNodeBlueprint(AssetData.Value))
 		{
 			UnsortedCategories.Emplace(Blueprint->BlueprintCategory);
 		}
@@ -378,6 +387,7 @@ void UFlowGraphSchema::GetFlowNodeActions(FGraphActionMenuBuilder& ActionMenuBui
 
 	// Flow Asset type might limit which nodes are placeable 
 	TArray<UFlowNode*> FilteredNodes;
+	TArray<FFlowNodeBlueprintTags> FilteredBlueprintNodes;
 	{
 		FilteredNodes.Reserve(NativeFlowNodes.Num() + BlueprintFlowNodes.Num());
 
@@ -388,7 +398,15 @@ void UFlowGraphSchema::GetFlowNodeActions(FGraphActionMenuBuilder& ActionMenuBui
 
 		for (const TPair<FName, FAssetData>& AssetData : BlueprintFlowNodes)
 		{
-			if (const UBlueprint* Blueprint = GetPlaceableNodeBlueprint(AssetData.Value))
+			FFlowNodeBlueprintTags NodeTags;
+			if (ReadBlueprintNodeTags(AssetData.Value, NodeTags))
+			{
+				if (NodeTags.bPlaceable && EditedFlowAsset && EditedFlowAsset->IsNodeClassAllowed(AssetData.Value, NodeTags))
+				{
+					FilteredBlueprintNodes.Emplace(MoveTemp(NodeTags));
+				}
+			}
+			else if (const UBlueprint* Blueprint = GetPlaceableNodeBlueprint(AssetData.Value))
 			{
 				ApplyNodeFilter(EditedFlowAsset, Blueprint->GeneratedClass, FilteredNodes);
 			}
@@ -405,6 +423,20 @@ void UFlowGraphSchema::GetFlowNodeActions(FGraphActionMenuBuilder& ActionMenuBui
 			ActionMenuBuilder.AddAction(NewNodeAction);
 		}
 	}
+
+	for (const FFlowNodeBlueprintTags& NodeTags : FilteredBlueprintNodes)
+	{
+		const bool bHiddenFromPalette = UFlowGraphSettings::Get()->NodesHiddenFromPalette.ContainsByPredicate([&NodeTags](const TSubclassOf<UFlowNode>& HiddenClass)
+		{
+			return HiddenClass && FName(*HiddenClass->GetPathName()) == NodeTags.GetNodeClassPath();
+		});
+
+		if ((CategoryName.IsEmpty() || CategoryName.Equals(NodeTags.Category)) && !bHiddenFromPalette)
+		{
+			TSharedPtr<FFlowGraphSchemaAction_NewNode> NewNodeAction(new FFlowGraphSchemaAction_NewNode(NodeTags));
+			ActionMenuBuilder.AddAction(NewNodeAction);
+		}
+	}
 }
 
 void UFlowGraphSchema::GetCommentAction(FGraphActionMenuBuilder& ActionMenuBuilder, const UEdGraph* CurrentGraph /*= nullptr*/)
@@ -561,6 +593,28 @@ void UFlowGraphSchema::OnAssetRemoved(const FAssetData& AssetData)
 	}
 }
 
+bool UFlowGraphSchema::ReadBlueprintNodeTags(const FAssetData& AssetData, FFlowNodeBlueprintTags& OutNodeTags)
+{
+	// loaded blueprint might have been modified since it was saved
+	if (AssetData.IsAssetLoaded())
+	{
+		return false;
+	}
+
+	// blueprint saved before tags were introduced has to be loaded once
+	return OutNodeTags.Read(AssetData);
+}
+
+void UFlowGraphSchema::OnAssetUpdated(const FAssetData& AssetData)
+{
+	// refresh asset registry tags read by the palette
+	if (FAssetData* RegisteredAssetData = BlueprintFlowNodes.Find(AssetData.PackageName))
+	{
+		*RegisteredAssetData = AssetData;
+		OnNodeListChanged.Broadcast();
+	}
+}
+
 UBlueprint* UFlowGraphSchema::GetPlaceableNodeBlueprint(const FAssetData& AssetData)
 {
 	UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset());
@@ -31,6 +31,11 @@ UEdGraphNode* FFlowGraphSchemaAction_NewNode::PerformAction(class UEdGraph* Pare
 		return nullptr;
 	}
 
+	if (NodeClass == nullptr && BlueprintNodeClass.IsValid())
+	{
+		NodeClass = BlueprintNodeClass.TryLoadClass<UFlowNode>();
+	}
+
 	if (NodeClass)
 	{
 		return CreateNode(ParentGraph, FromPin, NodeClass, Location, bSelectNewNode);
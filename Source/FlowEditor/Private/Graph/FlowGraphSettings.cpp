@@ -18,9 +18,12 @@ UFlowGraphSettings::UFlowGraphSettings(const FObjectInitializer& ObjectInitializ
 	, WorldAssetClass(UFlowAsset::StaticClass())
 	, bShowDefaultPinNames(false)
 	, ExecPinColorModifier(0.75f, 0.75f, 0.75f, 1.0f)
+	, bSimplifyZoomedOutNodes(true)
+	, bDeferUnconnectedPinWidgets(true)
 	, NodeDescriptionBackground(FLinearColor(0.0625f, 0.0625f, 0.0625f, 1.0f))
 	, NodeStatusBackground(FLinearColor(0.12f, 0.12f, 0.12f, 1.0f))
 	, NodePreloadedBackground(FLinearColor(0.12f, 0.12f, 0.12f, 1.0f))
+	, NodeStatusRefreshInterval(0.1f)
 	, ConnectionDrawType(EFlowConnectionDrawType::Default)
 	, CircuitConnectionAngle(45.f)
 	, CircuitConnectionSpacing(FVector2D(30.f))
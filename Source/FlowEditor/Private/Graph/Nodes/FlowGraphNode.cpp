@@ -56,7 +56,8 @@ UFlowNode* UFlowGraphNode::GetFlowNode() const
 	{
 		if (const UFlowAsset* InspectedInstance = FlowNode->GetFlowAsset()->GetInspectedInstance())
 		{
-			return InspectedInstance->GetNode(FlowNode->GetGuid());
+			// inspecting instance shouldn't create nodes
+			return InspectedInstance->FindInstancedNode(FlowNode->GetGuid());
 		}
 
 		return FlowNode;
@@ -141,6 +142,7 @@ void UFlowGraphNode::SubscribeToExternalChanges()
 	if (FlowNode)
 	{
 		FlowNode->OnReconstructionRequested.BindUObject(this, &UFlowGraphNode::OnExternalChange);
+		FlowNode->OnPropertyEdited.BindUObject(this, &UFlowGraphNode::OnFlowNodeEdited);
 	}
 }
 
@@ -155,6 +157,18 @@ void UFlowGraphNode::OnExternalChange()
 	GetGraph()->NotifyGraphChanged();
 }
 
+void UFlowGraphNode::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	OnNodeEdited.ExecuteIfBound();
+}
+
+void UFlowGraphNode::OnFlowNodeEdited() const
+{
+	OnNodeEdited.ExecuteIfBound();
+}
+
 void UFlowGraphNode::OnGraphRefresh()
 {
 	RefreshContextPins(true);
@@ -263,6 +277,13 @@ void UFlowGraphNode::ReconstructNode()
 	}
 
 	bNeedsFullReconstruction = false;
+
+	// pins might have changed, connections need to be harvested again before creating the next instance
+	if (UFlowGraph* FlowGraph = Cast<UFlowGraph>(GetGraph()))
+	{
+		FlowGraph->GetFlowAsset()->MarkNodeConnectionsDirty();
+		FlowGraph->GetWireRecords().MarkDirty();
+	}
 }
 
 void UFlowGraphNode::AllocateDefaultPins()
@@ -601,6 +622,13 @@ EFlowNodeState UFlowGraphNode::GetActivationState() const
 		{
 			return NodeInstance->GetActivationState();
 		}
+
+		// asset runs only on the server, a client of this process might have received its state
+		const UFlowAsset* TemplateAsset = FlowNode->GetFlowAsset();
+		if (GEditor->PlayWorld && TemplateAsset && TemplateAsset->GetInstancesNum() == 0)
+		{
+			return GEditor->GetEditorSubsystem<UFlowDebuggerSubsystem>()->GetReplicatedNodeState(TemplateAsset, FlowNode->GetGuid());
+		}
 	}
 
 	return EFlowNodeState::NeverActivated;
@@ -947,6 +975,24 @@ void UFlowGraphNode::OnOutputTriggered(const int32 Index)
 	TryPausingSession(false);
 }
 
+bool UFlowGraphNode::HasBreakpoints() const
+{
+	if (NodeBreakpoint.IsEnabled())
+	{
+		return true;
+	}
+
+	for (const TPair<FEdGraphPinReference, FFlowPinTrait>& PinBreakpoint : PinBreakpoints)
+	{
+		if (PinBreakpoint.Value.IsEnabled())
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
 void UFlowGraphNode::TryPausingSession(bool bPauseSession)
 {
 	// Node breakpoints waits on any pin triggered
@@ -48,29 +48,67 @@ void SFlowGraphNode::Construct(const FArguments& InArgs, UFlowGraphNode* InNode)
 
 	FlowGraphNode = InNode;
 	FlowGraphNode->OnSignalModeChanged.BindRaw(this, &SFlowGraphNode::UpdateGraphNode);
+	FlowGraphNode->OnNodeEdited.BindSP(this, &SFlowGraphNode::OnNodeEdited);
 
 	SetCursor(EMouseCursor::CardinalCross);
 	UpdateGraphNode();
 }
 
+void SFlowGraphNode::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SGraphNode::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	// widget is ticked only if it's visible, create remaining pins once user can interact with them
+	if (bHasDeferredPinWidgets && GetCurrentLOD() > EGraphRenderingLOD::LowestDetail)
+	{
+		bDisplayedInDetail = true;
+		UpdateGraphNode();
+	}
+}
+
 void SFlowGraphNode::GetNodeInfoPopups(FNodeInfoContext* Context, TArray<FGraphInformationPopupInfo>& Popups) const
 {
-	const FString& Description = FlowGraphNode->GetNodeDescription(); 
-	if (!Description.IsEmpty())
+	// popups aren't readable on zoomed out graph
+	if (UseSimplifiedNode())
 	{
-		const FGraphInformationPopupInfo DescriptionPopup = FGraphInformationPopupInfo(nullptr, UFlowGraphSettings::Get()->NodeDescriptionBackground, Description);
+		return;
+	}
+
+	const bool bPlaying = GEditor->PlayWorld != nullptr;
+	if (bDescriptionDirty || bDescriptionCachedWhilePlaying != bPlaying)
+	{
+		CachedDescription = FlowGraphNode->GetNodeDescription();
+		bDescriptionDirty = false;
+		bDescriptionCachedWhilePlaying = bPlaying;
+	}
+
+	if (!CachedDescription.IsEmpty())
+	{
+		const FGraphInformationPopupInfo DescriptionPopup = FGraphInformationPopupInfo(nullptr, UFlowGraphSettings::Get()->NodeDescriptionBackground, CachedDescription);
 		Popups.Add(DescriptionPopup);
 	}
 
-	if (GEditor->PlayWorld)
+	if (bPlaying)
 	{
-		const FString Status = FlowGraphNode->GetStatusString();
-		if (!Status.IsEmpty())
+		const double CurrentTime = FPlatformTime::Seconds();
+		const UFlowNode* NodeInstance = FlowGraphNode->GetInspectedNodeInstance();
+
+		if (CachedStatusNode.Get() != NodeInstance || CurrentTime >= StatusCacheTime + UFlowGraphSettings::Get()->NodeStatusRefreshInterval)
 		{
-			const FGraphInformationPopupInfo DescriptionPopup = FGraphInformationPopupInfo(nullptr, FlowGraphNode->GetStatusBackgroundColor(), Status);
+			CachedStatus = FlowGraphNode->GetStatusString();
+			CachedStatusBackground = FlowGraphNode->GetStatusBackgroundColor();
+			bCachedContentPreloaded = FlowGraphNode->IsContentPreloaded();
+
+			StatusCacheTime = CurrentTime;
+			CachedStatusNode = NodeInstance;
+		}
+
+		if (!CachedStatus.IsEmpty())
+		{
+			const FGraphInformationPopupInfo DescriptionPopup = FGraphInformationPopupInfo(nullptr, CachedStatusBackground, CachedStatus);
 			Popups.Add(DescriptionPopup);
 		}
-		else if (FlowGraphNode->IsContentPreloaded())
+		else if (bCachedContentPreloaded)
 		{
 			const FGraphInformationPopupInfo DescriptionPopup = FGraphInformationPopupInfo(nullptr, UFlowGraphSettings::Get()->NodeStatusBackground, TEXT("Preloaded"));
 			Popups.Add(DescriptionPopup);
@@ -100,6 +138,11 @@ const FSlateBrush* SFlowGraphNode::GetShadowBrush(bool bSelected) const
 
 void SFlowGraphNode::GetOverlayBrushes(bool bSelected, const FVector2D WidgetSize, TArray<FOverlayBrushInfo>& Brushes) const
 {
+	if (UseSimplifiedNode())
+	{
+		return;
+	}
+
 	// Node breakpoint
 	if (FlowGraphNode->NodeBreakpoint.IsAllowed())
 	{
@@ -166,6 +209,9 @@ void SFlowGraphNode::UpdateGraphNode()
 	InputPins.Empty();
 	OutputPins.Empty();
 
+	// node might have been reconstructed after changing its properties
+	bDescriptionDirty = true;
+
 	// Reset variables that are going to be exposed, in case we are refreshing an already setup node.
 	RightNodeBox.Reset();
 	LeftNodeBox.Reset();
@@ -519,6 +565,24 @@ TSharedPtr<SWidget> SFlowGraphNode::GetEnabledStateWidget() const
 	return TSharedPtr<SWidget>();
 }
 
+void SFlowGraphNode::CreatePinWidgets()
+{
+	// wires need only widgets of connected pins, others can wait until node is displayed with enough detail
+	const bool bDeferUnconnectedPins = UFlowGraphSettings::Get()->bDeferUnconnectedPinWidgets && !bDisplayedInDetail;
+	bHasDeferredPinWidgets = false;
+
+	for (UEdGraphPin* Pin : GraphNode->Pins)
+	{
+		if (bDeferUnconnectedPins && Pin->LinkedTo.Num() == 0)
+		{
+			bHasDeferredPinWidgets = true;
+			continue;
+		}
+
+		CreateStandardPinWidget(Pin);
+	}
+}
+
 void SFlowGraphNode::CreateStandardPinWidget(UEdGraphPin* Pin)
 {
 	const TSharedPtr<SGraphPin> NewPin = SNew(SFlowGraphPinExec, Pin);
@@ -663,6 +727,16 @@ FReply SFlowGraphNode::OnAddFlowPin(const EEdGraphPinDirection Direction)
 	return FReply::Handled();
 }
 
+bool SFlowGraphNode::UseSimplifiedNode() const
+{
+	return UFlowGraphSettings::Get()->bSimplifyZoomedOutNodes && GetCurrentLOD() <= EGraphRenderingLOD::LowestDetail;
+}
+
+void SFlowGraphNode::OnNodeEdited()
+{
+	bDescriptionDirty = true;
+}
+
 int32 SFlowGraphNode::ValidPinsCount(const TArray<FFlowPin>& Pins)
 {
 	int32 Count = 0;
@@ -4,9 +4,12 @@
 
 #include "EditorSubsystem.h"
 #include "Logging/TokenizedMessage.h"
+
+#include "FlowTypes.h"
 #include "FlowDebuggerSubsystem.generated.h"
 
 class UFlowAsset;
+class UFlowComponent;
 class FFlowMessageLog;
 
 /**
@@ -27,11 +30,19 @@ protected:
 	void OnInstancedTemplateRemoved(UFlowAsset* FlowAsset) const;
 	
 	void OnRuntimeMessageAdded(UFlowAsset* FlowAsset, const TSharedRef<FTokenizedMessage>& Message) const;
+
+	// Client components that received replicated Root Flow states during this play session
+	TArray<TWeakObjectPtr<UFlowComponent>> ReplicatedStateComponents;
+
+	void OnRootFlowStatesReplicated(UFlowComponent* FlowComponent);
 	
 	void OnBeginPIE(const bool bIsSimulating);
 	void OnEndPIE(const bool bIsSimulating);
 
 public:	
+	// Node state replicated to the client, used when the asset isn't instanced in this process, i.e. debugging a client of dedicated server
+	EFlowNodeState GetReplicatedNodeState(const UFlowAsset* TemplateAsset, const FGuid& NodeGuid) const;
+
 	static void PausePlaySession();
 	static bool IsPlaySessionPaused();
 };
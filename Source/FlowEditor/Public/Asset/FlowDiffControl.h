@@ -3,6 +3,7 @@
 #pragma once
 
 #include "DiffResults.h"
+#include "HAL/ThreadSafeBool.h"
 #include "IAssetTypeActions.h"
 #include "Editor/Kismet/Private/DiffControl.h"
 #include "Runtime/Launch/Resources/Version.h"
@@ -30,6 +31,8 @@ public:
 
 /////////////////////////////////////////////////////////////////////////////
 /// FFlowGraphToDiff: engine's FGraphToDiff customized to Flow Graph
+/// - nodes are matched by NodeGuid, node properties and pin connections are compared by hash
+/// - comparison runs on a background task, found differences are streamed into the differences tree
 struct FLOWEDITOR_API FFlowGraphToDiff : public TSharedFromThis<FFlowGraphToDiff>, IDiffControl
 {
 	FFlowGraphToDiff(class SFlowDiff* DiffWidget, UEdGraph* GraphOld, UEdGraph* GraphNew, const FRevisionInfo& RevisionOld, const FRevisionInfo& RevisionNew);
@@ -48,6 +51,8 @@ struct FLOWEDITOR_API FFlowGraphToDiff : public TSharedFromThis<FFlowGraphToDiff
 	/** Index of the first item in RealDifferences that was generated by this graph */
 	int32 RealDifferencesStartIndex = INDEX_NONE;
 
+	bool IsDiffInProgress() const { return bDiffInProgress; }
+
 private:
 	FText GetToolTip() const;
 	TSharedRef<SWidget> GenerateCategoryWidget() const;
@@ -55,7 +60,12 @@ private:
 	/** Called when the Newer Graph is modified*/
 	void OnGraphChanged(const FEdGraphEditAction& Action) const;
 
-	void BuildDiffSourceArray();
+	/** Snapshots both graphs on the game thread and launches the comparison task */
+	void StartDiff();
+
+	/** Game thread, receives the batch of differences found by the comparison task */
+	void AddFoundDiffs(TArray<FDiffSingleResult>&& NewDiffs);
+	void FinishDiff();
 
 	class SFlowDiff* DiffWidget;
 	UEdGraph* GraphOld;
@@ -66,4 +76,10 @@ private:
 	FRevisionInfo RevisionNew;
 
 	FDelegateHandle OnGraphChangedDelegateHandle;
+
+	/** Category entry of this graph, its children are added while the diff is in progress */
+	TSharedPtr<FBlueprintDifferenceTreeEntry> GraphEntry;
+
+	bool bDiffInProgress = false;
+	TSharedPtr<FThreadSafeBool, ESPMode::ThreadSafe> bCancelDiff;
 };
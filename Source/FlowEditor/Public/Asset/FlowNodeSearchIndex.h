@@ -0,0 +1,108 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "HAL/CriticalSection.h"
+#include "UObject/SoftObjectPath.h"
+
+class UFlowAsset;
+class UFlowGraphNode;
+class UFlowNode;
+struct FAssetData;
+
+struct FLOWEDITOR_API FFlowNodeReference
+{
+	FSoftObjectPath Asset;
+	FGuid NodeGuid;
+
+	FFlowNodeReference() {}
+
+	FFlowNodeReference(const FSoftObjectPath& InAsset, const FGuid& InNodeGuid)
+		: Asset(InAsset)
+		, NodeGuid(InNodeGuid)
+	{
+	}
+
+	bool operator==(const FFlowNodeReference& Other) const
+	{
+		return NodeGuid == Other.NodeGuid && Asset == Other.Asset;
+	}
+};
+
+/**
+ * Everything collected from a single Flow Node, reused until the node content changes
+ */
+struct FLOWEDITOR_API FFlowNodeIndexRecord
+{
+	// Hash of the serialized graph node and Flow Node
+	uint64 ContentHash = 0;
+
+	// Data answering reference queries
+	// path names of the node class and its parent classes, up to UFlowNode, like FFlowNodeBlueprintTags::ClassHierarchy
+	TArray<FName> ClassHierarchy;
+	TArray<FGameplayTag> Tags;
+	TArray<FSoftObjectPath> ReferencedFlowAssets;
+
+	// Text passed to the Asset Search by FFlowAssetIndexer
+	// properties are stored by display name, blueprint compilation replaces properties of the node class kept by records
+	FText Title;
+	TArray<TPair<FString, FText>> PinValues;
+	TArray<TPair<FString, FString>> GraphNodeProperties;
+	FString FlowNodeFriendlyName;
+	TArray<TPair<FString, FString>> FlowNodeProperties;
+
+	FName GetNodeClassPath() const { return ClassHierarchy[0]; }
+};
+
+/**
+ * Compact index of nodes placed in Flow Assets, answers class, tag and sub-graph reference queries without searching the full-text database
+ * - updated whenever Asset Search indexes the Flow Asset, only nodes with changed content hash are collected again
+ * - index is modified only on the game thread, queries can be issued from any thread as they compare only names and tags stored in the index
+ */
+class FLOWEDITOR_API FFlowNodeSearchIndex
+{
+public:
+	static FFlowNodeSearchIndex& Get();
+
+	void Initialize();
+	void Deinitialize();
+
+	// Game thread only, returned records are valid until the next update of the index
+	const TMap<FGuid, FFlowNodeIndexRecord>& UpdateAsset(const UFlowAsset& FlowAsset);
+	void RemoveAsset(const FSoftObjectPath& AssetPath);
+
+	// Loads assets missing in the index, the async loading processes many packages at once
+	void IndexAssets(const TArray<FAssetData>& AssetDataList);
+	int32 GetNumIndexedAssets() const;
+
+	TArray<FFlowNodeReference> FindNodesByClass(const UClass* NodeClass, const bool bIncludeSubclasses = true) const;
+	TArray<FFlowNodeReference> FindNodesByTag(const FGameplayTag& Tag, const bool bExactMatch = false) const;
+	TArray<FFlowNodeReference> FindSubGraphReferences(const FSoftObjectPath& FlowAssetPath) const;
+
+private:
+	static uint64 CalcContentHash(const UFlowGraphNode& GraphNode, const UFlowNode& FlowNode);
+	static void CollectRecord(const UFlowGraphNode& GraphNode, const UFlowNode& FlowNode, FFlowNodeIndexRecord& OutRecord);
+
+	void AddReferences(const FSoftObjectPath& AssetPath, const FGuid& NodeGuid, const FFlowNodeIndexRecord& Record);
+	void RemoveReferences(const FSoftObjectPath& AssetPath, const FFlowNodeIndexRecord& Record);
+
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+	TMap<FSoftObjectPath, TMap<FGuid, FFlowNodeIndexRecord>> IndexedAssets;
+
+	// Buckets are split per asset, so updating the asset doesn't require scanning references from other assets
+	using FNodesByAsset = TMap<FSoftObjectPath, TArray<FGuid>>;
+	TMap<FName, FNodesByAsset> NodesByClass;
+
+	// Class hierarchy of every class in NodesByClass, resolved on the game thread while collecting records
+	TMap<FName, TArray<FName>> ClassHierarchies;
+	TMap<FGameplayTag, FNodesByAsset> NodesByTag;
+	TMap<FSoftObjectPath, FNodesByAsset> SubGraphReferences;
+
+	TSet<FSoftObjectPath> PendingLoads;
+
+	mutable FRWLock Lock;
+};
@@ -0,0 +1,47 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "FlowValidateAssetsCommandlet.generated.h"
+
+struct FAssetData;
+
+// Result of successful validation, reused until the asset, its dependencies or the build change
+struct FFlowValidationCacheEntry
+{
+	FString Hash;
+
+	// Severity and text of messages reported by validation, i.e. warnings, replayed in the report when the asset is skipped
+	TArray<TPair<FString, FString>> Messages;
+};
+
+/**
+ * Validates all Flow Assets in the project, meant to be run on CI
+ * - assets unchanged since their last successful validation are skipped, including changes of packages they depend on and of the build
+ * - skipped assets are reported with messages of their last validation
+ * - packages are loaded asynchronously in batches, then validated on the game thread
+ * - writes a JSON report listing every asset with its result and messages
+ *
+ * Usage: UnrealEditor-Cmd.exe Project.uproject -run=FlowValidateAssets [-Path=/Game/Quests] [-Report=Path.json] [-Full] [-BatchSize=64]
+ * Returns 1 if any asset is invalid or failed to load
+ */
+UCLASS()
+class FLOWEDITOR_API UFlowValidateAssetsCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UFlowValidateAssetsCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+protected:
+	static FString GetCacheFilename();
+
+	// Hash of the build, the asset package and all packages it depends on, files are read on worker threads
+	static TArray<FString> CalcPackageHashes(const TArray<FAssetData>& AssetDataList);
+
+	static TMap<FString, FFlowValidationCacheEntry> LoadCache();
+	static void SaveCache(const TMap<FString, FFlowValidationCacheEntry>& ValidatedAssets);
+};
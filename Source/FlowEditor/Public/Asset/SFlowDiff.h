@@ -99,6 +99,17 @@ public:
 	/** Called when user clicks on an entry in the listview of differences */
 	void OnDiffListSelectionChanged(TSharedPtr<struct FDiffResultItem> TheDiff);
 
+	/** Called when the graph diff finds a difference, inserts its entry at the sorted position in RealDifferences */
+	void InsertGraphDifference(const int32 Index, const TSharedPtr<class FBlueprintDifferenceTreeEntry>& Entry);
+
+	int32 GetNumRealDifferences() const { return RealDifferences.Num(); }
+
+	/** Generates rows again, so the graph category picks up its new state */
+	void RefreshDifferencesTree() const;
+
+	/** Called when the graph diff found all differences, regenerates graph panels displaying this graph */
+	void OnGraphDiffFinished(const FFlowGraphToDiff* Diff);
+
 	/** Helper function for generating an empty widget */
 	static TSharedRef<SWidget> DefaultEmptyPanel();
 
@@ -146,6 +157,9 @@ protected:
 	/** Event handler that updates the graph view when user selects a new graph */
 	void HandleGraphChanged(const FString& GraphPath);
 
+	/** Generates graph panels if they don't display the graph yet */
+	void GenerateGraphPanels(const FString& GraphPath);
+
 	/** Function used to generate the list of differences and the widgets needed to calculate that list */
 	void GenerateDifferencesList();
 
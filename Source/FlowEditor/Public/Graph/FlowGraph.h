@@ -7,6 +7,8 @@
 #include "FlowAsset.h"
 #include "FlowGraph.generated.h"
 
+class UFlowGraphNode;
+
 class FLOWEDITOR_API FFlowGraphInterface : public IFlowGraphInterface
 {
 public:
@@ -14,6 +16,34 @@ public:
 
 	virtual void OnInputTriggered(UEdGraphNode* GraphNode, const int32 Index) const override;
 	virtual void OnOutputTriggered(UEdGraphNode* GraphNode, const int32 Index) const override;
+	virtual bool HasBreakpoints(const UFlowAsset& TemplateAsset) const override;
+};
+
+/**
+ * Output pins triggered by the inspected Flow Asset instance, used to highlight wires followed by the graph
+ * Updated when pins are triggered, so repainting the graph only reads it
+ */
+struct FLOWEDITOR_API FFlowGraphWireRecords
+{
+	// Time of the last activation of the output pin, nullptr if the pin hasn't been activated
+	const double* FindActivationTime(const UEdGraphPin* OutputPin) const { return OutputActivations.Find(OutputPin); }
+
+	// Rebuilds records if the inspected instance has changed or has been restarted
+	void Update(const UFlowAsset* InspectedInstance);
+
+	void OnOutputTriggered(const UFlowGraphNode& GraphNode, const int32 Index);
+
+	// Graph pins might have been recreated
+	void MarkDirty() { bDirty = true; }
+
+private:
+	void Rebuild(const UFlowAsset* InspectedInstance);
+
+	TMap<const UEdGraphPin*, double> OutputActivations;
+
+	TWeakObjectPtr<const UFlowAsset> Instance;
+	int32 NumRecordedNodes = 0;
+	bool bDirty = true;
 };
 
 UCLASS()
@@ -31,4 +61,9 @@ class FLOWEDITOR_API UFlowGraph : public UEdGraph
 
 	/** Returns the FlowAsset that contains this graph */
 	UFlowAsset* GetFlowAsset() const;
+
+	FFlowGraphWireRecords& GetWireRecords() { return WireRecords; }
+
+private:
+	FFlowGraphWireRecords WireRecords;
 };
@@ -23,6 +23,7 @@ struct FLOWEDITOR_API FFlowGraphConnectionDrawingPolicyFactory : public FGraphPa
 
 class FSlateWindowElementList;
 class UEdGraph;
+struct FFlowGraphWireRecords;
 
 // This class draws the connections between nodes
 class FLOWEDITOR_API FFlowGraphConnectionDrawingPolicy : public FConnectionDrawingPolicy
@@ -41,10 +42,12 @@ class FLOWEDITOR_API FFlowGraphConnectionDrawingPolicy : public FConnectionDrawi
 
 	// runtime values
 	UEdGraph* GraphObj;
-	TMap<UEdGraphPin*, UEdGraphPin*> RecentPaths;
-	TMap<UEdGraphPin*, UEdGraphPin*> RecordedPaths;
 	TMap<UEdGraphPin*, UEdGraphPin*> SelectedPaths;
 
+	// Wires followed by the inspected instance, owned by the graph
+	const FFlowGraphWireRecords* WireRecords;
+	double CurrentTime;
+
 	//Used to help reversing pins on nodes that go backwards
 	TMap<class UFlowGraphNode_Reroute*, bool> RerouteToReversedDirectionMap;
 
@@ -131,6 +131,9 @@ private:
 	bool CanToggleBreakpoint() const;
 	bool CanTogglePinBreakpoint();
 
+	// Instances of the asset report triggered pins only if the graph has breakpoints
+	void RefreshInstanceObservers() const;
+
 	void SetSignalMode(const EFlowSignalMode Mode) const;
 	bool CanSetSignalMode(const EFlowSignalMode Mode) const;
 
@@ -9,6 +9,7 @@
 class UFlowAsset;
 class UFlowNode;
 class UFlowGraphNode;
+struct FFlowNodeBlueprintTags;
 
 DECLARE_MULTICAST_DELEGATE(FFlowGraphSchemaRefresh);
 
@@ -69,10 +70,14 @@ private:
 	static void OnAssetAdded(const FAssetData& AssetData);
 	static void AddAsset(const FAssetData& AssetData, const bool bBatch);
 	static void OnAssetRemoved(const FAssetData& AssetData);
+	static void OnAssetUpdated(const FAssetData& AssetData);
 
 public:
 	static FFlowGraphSchemaRefresh OnNodeListChanged;
 	static UBlueprint* GetPlaceableNodeBlueprint(const FAssetData& AssetData);
 
+	// Returns false if the blueprint is loaded or has been saved without Flow Node tags
+	static bool ReadBlueprintNodeTags(const FAssetData& AssetData, FFlowNodeBlueprintTags& OutNodeTags);
+
 	static const UFlowAsset* GetAssetClassDefaults(const UEdGraph* Graph);
 };
@@ -6,6 +6,7 @@
 
 #include "Nodes/FlowGraphNode.h"
 #include "Nodes/FlowNode.h"
+#include "Nodes/FlowNodeBlueprint.h"
 #include "FlowGraphSchema_Actions.generated.h"
 
 /** Action to add a node to the graph */
@@ -17,6 +18,10 @@ struct FLOWEDITOR_API FFlowGraphSchemaAction_NewNode : public FEdGraphSchemaActi
 	UPROPERTY()
 	class UClass* NodeClass;
 
+	// Blueprint node listed by its asset registry tags, class is loaded once user places the node
+	UPROPERTY()
+	FSoftClassPath BlueprintNodeClass;
+
 	static FName StaticGetTypeId()
 	{
 		static FName Type("FFlowGraphSchemaAction_NewNode");
@@ -43,6 +48,13 @@ struct FLOWEDITOR_API FFlowGraphSchemaAction_NewNode : public FEdGraphSchemaActi
 	{
 	}
 
+	FFlowGraphSchemaAction_NewNode(const FFlowNodeBlueprintTags& NodeTags)
+		: FEdGraphSchemaAction(FText::FromString(NodeTags.Category), NodeTags.Title, NodeTags.ToolTip, 0, FText::FromString(NodeTags.Keywords))
+		, NodeClass(nullptr)
+		, BlueprintNodeClass(NodeTags.GetNodeClassPath().ToString())
+	{
+	}
+
 	// FEdGraphSchemaAction
 	virtual UEdGraphNode* PerformAction(class UEdGraph* ParentGraph, UEdGraphPin* FromPin, const FVector2D Location, bool bSelectNewNode = true) override;
 	// --
@@ -61,6 +61,14 @@ class FLOWEDITOR_API UFlowGraphSettings : public UDeveloperSettings
 	UPROPERTY(EditAnywhere, config, Category = "Nodes")
 	FLinearColor ExecPinColorModifier;
 
+	/** Zoomed out graph draws nodes as simple boxes, without node popups and breakpoint icons */
+	UPROPERTY(EditAnywhere, config, Category = "Nodes")
+	bool bSimplifyZoomedOutNodes;
+
+	/** Widgets of pins without connections are created once the node is displayed with enough detail, speeds up opening large graphs */
+	UPROPERTY(EditAnywhere, config, Category = "Nodes")
+	bool bDeferUnconnectedPinWidgets;
+
 	UPROPERTY(EditAnywhere, config, Category = "NodePopups")
 	FLinearColor NodeDescriptionBackground;
 
@@ -70,6 +78,10 @@ class FLOWEDITOR_API UFlowGraphSettings : public UDeveloperSettings
 	UPROPERTY(EditAnywhere, config, Category = "NodePopups")
 	FLinearColor NodePreloadedBackground;
 
+	/** How often node status is refreshed while playing, in seconds. Node description is refreshed after editing the node */
+	UPROPERTY(EditAnywhere, config, Category = "NodePopups", meta = (ClampMin = 0.0f))
+	float NodeStatusRefreshInterval;
+
 	UPROPERTY(config, EditAnywhere, Category = "Wires")
 	EFlowConnectionDrawType ConnectionDrawType;
 
@@ -49,6 +49,7 @@ public:
 	virtual void PostLoad() override;
 	virtual void PostDuplicate(bool bDuplicateForPIE) override;
 	virtual void PostEditImport() override;
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 	// --
 
 	// UEdGraphNode
@@ -61,10 +62,14 @@ public:
 private:
 	void SubscribeToExternalChanges();
 	void OnExternalChange();
+	void OnFlowNodeEdited() const;
 
 public:
 	virtual void OnGraphRefresh();
 
+	// Called after editing properties of this graph node or its Flow Node
+	FFlowGraphNodeEvent OnNodeEdited;
+
 //////////////////////////////////////////////////////////////////////////
 // Graph node
 
@@ -181,6 +186,9 @@ public:
 	void OnInputTriggered(const int32 Index);
 	void OnOutputTriggered(const int32 Index);
 
+	// Any enabled breakpoint on the node or its pins
+	bool HasBreakpoints() const;
+
 private:
 	void TryPausingSession(bool bPauseSession);
 
@@ -27,6 +27,10 @@ public:
 	void Construct(const FArguments& InArgs, UFlowGraphNode* InNode);
 
 protected:
+	// SWidget
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+	// --
+
 	// SNodePanel::SNode
 	virtual void GetNodeInfoPopups(FNodeInfoContext* Context, TArray<FGraphInformationPopupInfo>& Popups) const override;
 	virtual const FSlateBrush* GetShadowBrush(bool bSelected) const override;
@@ -50,6 +54,7 @@ protected:
 	FLinearColor GetNodeTitleTextColor() const;
 	TSharedPtr<SWidget> GetEnabledStateWidget() const;
 
+	virtual void CreatePinWidgets() override;
 	virtual void CreateStandardPinWidget(UEdGraphPin* Pin) override;
 	virtual TSharedPtr<SToolTip> GetComplexTooltip() override;
 
@@ -63,9 +68,32 @@ protected:
 	// Variant of SGraphNode::OnAddPin
 	virtual FReply OnAddFlowPin(const EEdGraphPinDirection Direction);
 
+	// Zoomed out node is drawn as a simple box
+	bool UseSimplifiedNode() const;
+
+	void OnNodeEdited();
+
 private:
 	static int32 ValidPinsCount(const TArray<FFlowPin>& Pins);
 
 protected:
 	UFlowGraphNode* FlowGraphNode = nullptr;
+
+	// Node has been displayed with enough detail to need all pin widgets
+	bool bDisplayedInDetail = false;
+
+	// Some pin widgets haven't been created yet
+	bool bHasDeferredPinWidgets = false;
+
+	// Popups are gathered every frame, but description changes only after editing the node
+	mutable FString CachedDescription;
+	mutable bool bDescriptionDirty = true;
+	mutable bool bDescriptionCachedWhilePlaying = false;
+
+	// Node status is refreshed in intervals, or after changing the inspected node instance
+	mutable FString CachedStatus;
+	mutable FLinearColor CachedStatusBackground = FLinearColor::Black;
+	mutable bool bCachedContentPreloaded = false;
+	mutable double StatusCacheTime = -1.0;
+	mutable TWeakObjectPtr<const UFlowNode> CachedStatusNode;
 };